@@ -0,0 +1,36 @@
+/**
+ * Scheduler implementation
+ */
+
+#include "scheduler.hpp"
+#include <algorithm>
+
+sf::Clock Scheduler::clock;
+std::multimap<sf::Time, std::function<void()>> Scheduler::actions;
+
+void Scheduler::after(const sf::Time delay, std::function<void()> action) {
+    Scheduler::actions.emplace(Scheduler::clock.getElapsedTime() + delay, std::move(action));
+}
+
+void Scheduler::runDue() {
+    const sf::Time now = Scheduler::clock.getElapsedTime();
+    while (!Scheduler::actions.empty() && Scheduler::actions.begin()->first <= now) {
+        // Remove the action before running it, as it may add or clear actions
+        std::function<void()> action = std::move(Scheduler::actions.begin()->second);
+        Scheduler::actions.erase(Scheduler::actions.begin());
+        action();
+    }
+}
+
+bool Scheduler::pending() {
+    return !Scheduler::actions.empty();
+}
+
+sf::Time Scheduler::untilNext() {
+    if (Scheduler::actions.empty()) return sf::Time::Zero;
+    return std::max(sf::Time::Zero, Scheduler::actions.begin()->first - Scheduler::clock.getElapsedTime());
+}
+
+void Scheduler::clear() {
+    Scheduler::actions.clear();
+}
@@ -0,0 +1,48 @@
+/**
+ * Runs actions after a delay without blocking the window: the screen manager runs the actions that are due on every
+ * iteration of the event loop, so the game keeps handling events and rendering while it waits
+ */
+
+#ifndef BATTLESHIP_SCHEDULER_H
+#define BATTLESHIP_SCHEDULER_H
+
+#include <SFML/System.hpp>
+#include <functional>
+#include <map>
+
+class Scheduler {
+public:
+    /**
+     * Runs an action once the delay has passed (actions with the same due time run in the order they were added)
+     */
+    static void after(sf::Time delay, std::function<void()> action);
+
+    /**
+     * Runs every action that is due
+     */
+    static void runDue();
+
+    /**
+     * Returns true if there are actions waiting to run
+     */
+    static bool pending();
+
+    /**
+     * Returns the time left until the next action is due (zero if there are no actions or one is overdue)
+     */
+    static sf::Time untilNext();
+
+    /**
+     * Discards every waiting action
+     */
+    static void clear();
+
+private:
+    // Measures the time since the game started
+    static sf::Clock clock;
+
+    // Waiting actions, ordered by the time they are due
+    static std::multimap<sf::Time, std::function<void()>> actions;
+};
+
+#endif// BATTLESHIP_SCHEDULER_H
@@ -3,6 +3,7 @@
  */
 
 #include "screenManager.hpp"
+#include "../helpers/AssetLoader.hpp"
 #include "../screens/difficultySelection.hpp"
 #include "../screens/fleetPlacement.hpp"
 #include "../screens/gameModeSelection.hpp"
@@ -11,28 +12,83 @@
 #include "../screens/homepage.hpp"
 #include "../screens/instructions.hpp"
 #include "../screens/intermediary.hpp"
+#include "scheduler.hpp"
 
 using screen::ScreenManager;
 using screen::Screens;
 
+const std::map<Screens, ScreenManager::ScreenInfo> ScreenManager::screenInfo = {
+        {Homepage, {[]() -> ScreenTemplate & { return Homepage::getInstance(); }, "homepage"}},
+        {GameModeSelection, {[]() -> ScreenTemplate & { return GameModeSelection::getInstance(); }, "gameModeSelection"}},
+        {Instructions, {[]() -> ScreenTemplate & { return Instructions::getInstance(); }, "instructions"}},
+        {DifficultySelection, {[]() -> ScreenTemplate & { return DifficultySelection::getInstance(); }, "difficultySelection"}},
+        {FleetPlacement, {[]() -> ScreenTemplate & { return FleetPlacement::getInstance(); }, "fleetPlacement"}},
+        {Gameplay, {[]() -> ScreenTemplate & { return Gameplay::getInstance(); }, "gameplay"}},
+        {Intermediary, {[]() -> ScreenTemplate & { return Intermediary::getInstance(); }, "intermediary"}},
+        {GameOver, {[]() -> ScreenTemplate & { return GameOver::getInstance(); }, "gameOver"}},
+};
+
 ScreenManager::ScreenManager() {
+    // Start decoding every screen's images in the background, in the order they are usually needed
+    for (const Screens screen : {Homepage, GameModeSelection, Instructions, DifficultySelection,
+                                 FleetPlacement, Gameplay, Intermediary, GameOver}) {
+        AssetLoader::preload(ScreenResourceManager::assetFiles(screenInfo.at(screen).folder));
+    }
+
     State::gui = std::make_unique<sf::RenderWindow>(sf::VideoMode(State::width, State::height), "Battleship", sf::Style::Titlebar | sf::Style::Close);
     State::gui->setFramerateLimit(60);
+}
 
-    screenList[Homepage] = &Homepage::getInstance();
-    screenList[Instructions] = &Instructions::getInstance();
-    screenList[GameModeSelection] = &GameModeSelection::getInstance();
-    screenList[DifficultySelection] = &DifficultySelection::getInstance();
-    screenList[FleetPlacement] = &FleetPlacement::getInstance();
-    screenList[Gameplay] = &Gameplay::getInstance();
-    screenList[Intermediary] = &Intermediary::getInstance();
-    screenList[GameOver] = &GameOver::getInstance();
+screen::ScreenTemplate &ScreenManager::getScreen(const Screens screen) {
+    const auto created = screenList.find(screen);
+    if (created != screenList.end()) return *created->second;
+
+    const ScreenInfo &info = screenInfo.at(screen);
+    showLoadingScreen(ScreenResourceManager::assetFiles(info.folder));
+
+    ScreenTemplate &instance = info.getInstance();
+    screenList[screen] = &instance;
+    return instance;
+}
+
+void ScreenManager::showLoadingScreen(const vector<string> &files) {
+    sf::RenderWindow &gui = *State::gui;
+
+    const sf::Vector2f barSize(State::width / 3.0f, 24);
+    sf::RectangleShape outline(barSize), bar;
+    outline.setPosition((State::width - barSize.x) / 2, (State::height - barSize.y) / 2);
+    outline.setFillColor(sf::Color::Transparent);
+    outline.setOutlineColor(sf::Color::White);
+    outline.setOutlineThickness(2);
+    bar.setPosition(outline.getPosition());
+    bar.setFillColor(sf::Color::White);
+
+    while (gui.isOpen() && !AssetLoader::decoded(files)) {
+        while (gui.pollEvent(State::event)) {
+            if (State::event.type == sf::Event::Closed) gui.close();
+        }
+
+        bar.setSize(sf::Vector2f(barSize.x * AssetLoader::progress(), barSize.y));
+        gui.clear();
+        gui.draw(outline);
+        gui.draw(bar);
+        gui.display();
+    }
 }
 
 void ScreenManager::run() {
     State::gui->setKeyRepeatEnabled(false);
 
+    Screens shown = State::getCurrentScreen();
     while (State::gui->isOpen()) {
-        screenList[State::getCurrentScreen()]->run();
+        Scheduler::runDue();
+
+        // A screen has to be redrawn whenever it is switched to
+        if (State::getCurrentScreen() != shown) {
+            shown = State::getCurrentScreen();
+            getScreen(shown).invalidate();
+        }
+        if (!State::gui->isOpen()) break;// Closed while loading
+        getScreen(shown).run();
     }
 }
@@ -8,6 +8,7 @@
 
 #include "../controllers/screenTemplate.hpp"
 #include "state.hpp"
+#include <functional>
 #include <map>
 
 namespace screen {
@@ -24,8 +25,21 @@ namespace screen {
         void run();
 
     private:
-        // All the different screens instances, mapped to by their name
+        // How to create each screen and the folder of its images (res/images/<folder>)
+        struct ScreenInfo {
+            std::function<ScreenTemplate &()> getInstance;
+            string folder;
+        };
+        static const std::map<Screens, ScreenInfo> screenInfo;
+
+        // The screens that have been created so far, mapped to by their name (screens are created when first shown)
         std::map<Screens, ScreenTemplate *> screenList;
+
+        // Returns a screen, creating it first if needed
+        ScreenTemplate &getScreen(Screens screen);
+
+        // Shows a loading bar until a screen's images have been decoded
+        static void showLoadingScreen(const vector<string> &files);
     };
 }// namespace screen
 
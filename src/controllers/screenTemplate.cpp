@@ -3,13 +3,65 @@
  */
 
 #include "screenTemplate.hpp"
+#include "scheduler.hpp"
+#include <algorithm>
 
 using screen::ScreenTemplate;
 
 ScreenTemplate::ScreenTemplate() : resources("", {}, {}, {}) {}
 
 void screen::ScreenTemplate::run() {
+    sf::RenderWindow &gui = *State::gui;
+    const Screens screen = State::getCurrentScreen();
+
+    // Nothing to redraw: sleep until the user does something (or the next scheduled action is due)
+    if (!this->dirty && !this->animating()) {
+        if (Scheduler::pending()) {
+            sf::sleep(std::min(Scheduler::untilNext(), sf::milliseconds(10)));
+        } else if (gui.waitEvent(State::event)) {
+            this->dispatch(State::event);
+        }
+    }
+
+    // Stop as soon as another screen is shown (it will handle the remaining events)
+    if (State::getCurrentScreen() != screen) return;
     this->update();
+    if (State::getCurrentScreen() != screen) return;
     this->poll();
-    this->render();
+    if (State::getCurrentScreen() != screen) return;
+
+    if ((this->dirty || this->animating()) && gui.isOpen()) {
+        this->render();
+        this->dirty = false;
+    }
+}
+
+void screen::ScreenTemplate::invalidate() {
+    this->dirty = true;
+}
+
+void screen::ScreenTemplate::poll() {
+    sf::RenderWindow &gui = *State::gui;
+    const Screens screen = State::getCurrentScreen();
+
+    while (State::getCurrentScreen() == screen && gui.pollEvent(State::event)) {
+        this->dispatch(State::event);
+    }
+}
+
+void screen::ScreenTemplate::dispatch(const sf::Event &event) {
+    switch (event.type) {
+        case sf::Event::Closed:// Let the screen stop what it is doing first
+            this->handleEvent(event);
+            State::gui->close();
+            return;
+        case sf::Event::GainedFocus:// The window may have been covered
+        case sf::Event::Resized:
+        case sf::Event::MouseButtonReleased:// Clicks usually change what is shown
+            this->invalidate();
+            break;
+        default:
+            break;
+    }
+    this->handleEvent(event);
 }
@@ -15,10 +15,16 @@ namespace screen {
     class ScreenTemplate {
     public:
         /**
-         * Renders this screen to the GUI
+         * Runs one iteration of this screen's event loop: handles input and renders the screen if it changed
+         * When nothing changed, this waits for the next event instead of drawing the same frame again
          */
         void run();
 
+        /**
+         * Marks this screen as changed so it is rendered again in the next iteration
+         */
+        void invalidate();
+
         // Do not allow copying of this screen's instance
         ScreenTemplate(const ScreenTemplate &other) = delete;
 
@@ -40,11 +46,25 @@ namespace screen {
         // such as checking if the mouse is above a button
         virtual void update() = 0;
 
-        // Pool for events. Make sure to poll for if the user clicks the X button on the window
-        virtual void poll() = 0;
+        // Handle a single SFML event here (closing the window is handled for all screens)
+        // Call invalidate() when the event changes what is shown
+        virtual void handleEvent(const sf::Event &event) = 0;
 
         // Render all sprites to the screen here
         virtual void render() = 0;
+
+        // Return true while the screen changes without any user input so it keeps running every frame
+        virtual bool animating() const { return false; }
+
+    private:
+        // True if the screen changed since it was last rendered
+        bool dirty = true;
+
+        // Handles every pending event (stops if an event changes the screen)
+        void poll();
+
+        // Handles the events common to all screens, then passes the event to the screen
+        void dispatch(const sf::Event &event);
     };
 
 }// namespace screen
@@ -9,6 +9,7 @@
 #ifndef BATTLESHIP_STATE_H
 #define BATTLESHIP_STATE_H
 
+#include "../engine/difficulty.hpp"
 #include "../enums/screens.hpp"
 #include <SFML/Graphics.hpp>
 #include <iostream>
@@ -46,13 +47,13 @@ public:
     static GameMode gameMode;
 
     /**
-     * The possible game difficulties: EASY and HARD
+     * The possible game difficulties: EASY, MEDIUM, HARD and EXPERT (see engine::difficultyTiers)
+     * The difficulty selection screen has a button for each (the 1 to 4 keys pick them too)
      */
-    enum Difficulty { EASY,
-                      HARD };
+    typedef engine::Difficulty Difficulty;
 
     /**
-     * The selected difficulty (EASY or HARD)
+     * The selected difficulty
      */
     static Difficulty difficulty;
 
@@ -0,0 +1,51 @@
+/**
+ * AsyncMove class implementation
+ */
+
+#include "asyncMove.hpp"
+#include <stdexcept>
+
+using engine::AsyncMove;
+
+AsyncMove::AsyncMove() : worker(1), cancelled(false), duration(0) {}
+
+AsyncMove::~AsyncMove() {
+    cancel();
+}
+
+void AsyncMove::start(Strategy &strategy, const Grid &opponent) {
+    if (running()) {
+        throw std::invalid_argument("The computer is already deciding a move!");
+    }
+
+    cancelled = false;
+    result = worker.submit([this, &strategy, grid = opponent] {
+        const auto start = std::chrono::steady_clock::now();
+        const Coordinate move = strategy.cancellableNextTarget(grid, cancelled);
+        duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        return move;
+    });
+}
+
+bool AsyncMove::running() const {
+    return result.valid();
+}
+
+std::optional<Coordinate> AsyncMove::poll() {
+    if (!result.valid() || result.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return std::nullopt;
+    }
+    return result.get();
+}
+
+void AsyncMove::cancel() {
+    if (!result.valid()) return;
+
+    cancelled = true;
+    result.wait();
+    result = std::future<Coordinate>();
+}
+
+std::chrono::microseconds AsyncMove::lastDuration() const {
+    return std::chrono::microseconds(duration.load());
+}
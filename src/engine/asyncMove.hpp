@@ -0,0 +1,82 @@
+/**
+ * A computer player's decision made on a worker thread, so the screen keeps drawing while the computer thinks
+ *
+ * The strategy decides on a copy of the opponent's grid. The move is collected with poll() once it is ready,
+ * or thrown away with cancel(), which also makes the strategy stop searching
+ */
+
+#ifndef BATTLESHIP_ASYNCMOVE_H
+#define BATTLESHIP_ASYNCMOVE_H
+
+#include "strategy.hpp"
+#include "threadPool.hpp"
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <optional>
+
+namespace engine {
+
+    class AsyncMove {
+    public:
+        /**
+         * Starts the worker thread (no move is being decided)
+         */
+        AsyncMove();
+
+        /**
+         * Cancels the move being decided, if there is one
+         */
+        ~AsyncMove();
+
+        // The worker thread can't be copied
+        AsyncMove(const AsyncMove &source) = delete;
+        AsyncMove &operator=(const AsyncMove &source) = delete;
+
+        /**
+         * Starts deciding the strategy's next move on the worker thread
+         * The strategy must not be used elsewhere until the move has been collected or cancelled
+         *
+         * Throws std::invalid_argument if a move is already being decided
+         */
+        void start(Strategy &strategy, const Grid &opponent);
+
+        /**
+         * Returns true if a move has been started and not collected or cancelled yet
+         */
+        [[nodiscard]] bool running() const;
+
+        /**
+         * Returns the move if it has been decided (it can only be collected once), or nothing if it is
+         * still being decided or no move was started
+         */
+        std::optional<Coordinate> poll();
+
+        /**
+         * Stops deciding the current move and throws it away
+         * Returns once the strategy has stopped, which takes well under a frame
+         */
+        void cancel();
+
+        /**
+         * Returns how long the strategy took to decide the last move collected with poll()
+         */
+        [[nodiscard]] std::chrono::microseconds lastDuration() const;
+
+    private:
+        // Thread the moves are decided on
+        ThreadPool worker;
+
+        // The move being decided (not valid if there is none)
+        std::future<Coordinate> result;
+
+        // Set to make the strategy stop deciding
+        std::atomic<bool> cancelled;
+
+        // Microseconds the last move took to decide (written by the worker thread)
+        std::atomic<long long> duration;
+    };
+
+}// namespace engine
+
+#endif//BATTLESHIP_ASYNCMOVE_H
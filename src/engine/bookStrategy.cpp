@@ -0,0 +1,24 @@
+/**
+ * BookStrategy class implementation
+ */
+
+#include "bookStrategy.hpp"
+
+using engine::BookStrategy;
+
+BookStrategy::BookStrategy(std::shared_ptr<const OpeningBook> book, std::unique_ptr<Strategy> strategy)
+    : book(std::move(book)), strategy(std::move(strategy)) {}
+
+Coordinate BookStrategy::nextTarget(const Grid &opponent) {
+    if (const std::optional<Coordinate> shot = book->next(opponent)) return *shot;
+    return strategy->nextTarget(opponent);
+}
+
+Coordinate BookStrategy::cancellableNextTarget(const Grid &opponent, const std::atomic<bool> &cancelled) {
+    if (const std::optional<Coordinate> shot = book->next(opponent)) return *shot;
+    return strategy->cancellableNextTarget(opponent, cancelled);
+}
+
+void BookStrategy::reset() {
+    strategy->reset();
+}
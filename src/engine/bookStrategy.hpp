@@ -0,0 +1,41 @@
+/**
+ * Computer player that plays the shots of an opening book while the game is still in it, and leaves every
+ * other move to another strategy
+ */
+
+#ifndef BATTLESHIP_BOOKSTRATEGY_H
+#define BATTLESHIP_BOOKSTRATEGY_H
+
+#include "openingBook.hpp"
+#include "strategy.hpp"
+#include <memory>
+
+namespace engine {
+
+    class BookStrategy : public Strategy {
+    public:
+        /**
+         * @param book the opening book (shared, as it never changes)
+         * @param strategy decides the moves once the game has left the book
+         */
+        BookStrategy(std::shared_ptr<const OpeningBook> book, std::unique_ptr<Strategy> strategy);
+
+        /**
+         * Returns the book's next shot, or the other strategy's choice if the game has left the book
+         */
+        Coordinate nextTarget(const Grid &opponent) override;
+        Coordinate cancellableNextTarget(const Grid &opponent, const std::atomic<bool> &cancelled) override;
+
+        /**
+         * Resets the other strategy
+         */
+        void reset() override;
+
+    private:
+        std::shared_ptr<const OpeningBook> book;
+        std::unique_ptr<Strategy> strategy;
+    };
+
+}// namespace engine
+
+#endif//BATTLESHIP_BOOKSTRATEGY_H
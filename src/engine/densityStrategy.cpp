@@ -0,0 +1,68 @@
+/**
+ * DensityStrategy class implementation
+ */
+
+#include "densityStrategy.hpp"
+#include "../helpers/gameHelpers.hpp"
+#include "placements.hpp"
+#include <stdexcept>
+
+using engine::DensityStrategy;
+using entity::shipCount;
+
+DensityStrategy::DensityStrategy(const bool finishHits) : finishHits(finishHits) {}
+
+DensityStrategy::DensityMap DensityStrategy::density(const Grid &opponent, const bool finishHits) {
+    const Bitboard hits = opponent.getHitSquares();
+    const Bitboard sunk = opponent.getSunkSquares();
+    const Bitboard openHits = hits.andNot(sunk);// Hits on ships that are still afloat
+
+    // Squares no remaining ship can occupy: misses, sunk ships and the squares next to sunk ships
+    const Bitboard blocked = opponent.getMissSquares() | sunk | neighbourSquares(sunk);
+
+    // Placements that cover an open hit are weighted far above the rest, so the hunt for a new ship
+    // only matters when there is nothing left to finish off
+    const int targetWeight = finishHits ? 1 << 16 : 1;
+
+    DensityMap counts{};
+    for (int ship = 0; ship < shipCount; ++ship) {
+        if (opponent.isSunk(static_cast<shipNames>(ship))) continue;
+
+        for (const Placement &placement : shipPlacements(static_cast<shipNames>(ship))) {
+            // The ship can't be on a known empty square, or touch a hit that belongs to another ship
+            if ((placement.squares & blocked).any() || (placement.neighbours & openHits).any()) continue;
+
+            const int covered = (placement.squares & openHits).count();
+            const int weight = covered == 0 ? 1 : covered * targetWeight;
+
+            Bitboard untried = placement.squares.andNot(hits);
+            while (untried.any()) {
+                counts[untried.popLowest()] += weight;
+            }
+        }
+    }
+    return counts;
+}
+
+Coordinate DensityStrategy::nextTarget(const Grid &opponent) {
+    const DensityMap counts = density(opponent, finishHits);
+    const Bitboard tried = opponent.getHitSquares() | opponent.getMissSquares();
+
+    // Pick the highest count, breaking ties at random so the computer isn't predictable
+    int best = -1, bestCount = -1, ties = 0;
+    for (int square = 0; square < Grid::size * Grid::size; ++square) {
+        if (tried.test(square)) continue;
+
+        if (counts[square] > bestCount) {
+            best = square;
+            bestCount = counts[square];
+            ties = 1;
+        } else if (counts[square] == bestCount && randomInt(0, ties++) == 0) {
+            best = square;
+        }
+    }
+    if (best == -1) {
+        throw std::invalid_argument("Every square has been attacked- this game is in an impossible state!");
+    }
+    return Coordinate::fromIndex(best);
+}
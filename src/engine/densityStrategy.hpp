@@ -0,0 +1,48 @@
+/**
+ * Computer player that attacks the square most likely to hold a ship
+ *
+ * Every position each ship still afloat could be in (given the hits, misses and sunk ships so far)
+ * is counted, and the square covered by the most positions is attacked. Once a ship has been hit,
+ * only positions that cover the unsunk hits are counted, so the ship is finished off first (if finishHits is
+ * set; otherwise a hit only adds to the count of each position covering it)
+ */
+
+#ifndef BATTLESHIP_DENSITYSTRATEGY_H
+#define BATTLESHIP_DENSITYSTRATEGY_H
+
+#include "strategy.hpp"
+#include <array>
+
+namespace engine {
+
+    class DensityStrategy : public Strategy {
+    public:
+        /**
+         * @param finishHits if positions covering unsunk hits are counted before all the others
+         */
+        explicit DensityStrategy(bool finishHits = true);
+
+        /**
+         * Returns the untried square covered by the most possible ship positions
+         */
+        Coordinate nextTarget(const Grid &opponent) override;
+
+        /**
+         * Number of possible ship positions covering each square (indexed by y * Grid::size + x)
+         */
+        typedef std::array<int, Grid::size * Grid::size> DensityMap;
+
+        /**
+         * Counts the possible ship positions covering each untried square of the opponent's grid
+         * (positions covering unsunk hits far above the rest if finishHits is set)
+         */
+        static DensityMap density(const Grid &opponent, bool finishHits = true);
+
+    private:
+        // If positions covering unsunk hits are counted before all the others
+        bool finishHits;
+    };
+
+}// namespace engine
+
+#endif//BATTLESHIP_DENSITYSTRATEGY_H
@@ -0,0 +1,65 @@
+/**
+ * Difficulty tiers implementation
+ */
+
+#include "difficulty.hpp"
+#include "bookStrategy.hpp"
+#include "densityStrategy.hpp"
+#include "huntTargetStrategy.hpp"
+#include "monteCarloStrategy.hpp"
+#include "randomStrategy.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+
+namespace {
+    // Returns a new strategy that decides moves the way a tier searches
+    std::unique_ptr<engine::Strategy> makeSearch(const engine::DifficultyTier &tier, const unsigned threads) {
+        switch (tier.search) {
+            case engine::Search::Random:
+                return std::make_unique<engine::RandomStrategy>();
+            case engine::Search::HuntTarget:
+                return std::make_unique<engine::HuntTargetStrategy>();
+            case engine::Search::Counting:
+                return std::make_unique<engine::DensityStrategy>(false);
+            case engine::Search::Sampling:
+                return std::make_unique<engine::MonteCarloStrategy>(tier.budget, threads);
+        }
+        return nullptr;
+    }
+}// namespace
+
+std::unique_ptr<engine::Strategy> engine::makeStrategy(const Difficulty difficulty, const unsigned threads,
+                                                       const std::shared_ptr<const OpeningBook> &book) {
+    const DifficultyTier &tier = difficultyTiers[difficulty];
+    std::unique_ptr<Strategy> strategy = makeSearch(tier, threads);
+    if (tier.openingBook && book != nullptr && !book->empty()) {
+        return std::make_unique<BookStrategy>(book, std::move(strategy));
+    }
+    return strategy;
+}
+
+std::optional<engine::Difficulty> engine::difficultyFromName(const std::string &name) {
+    for (int difficulty = 0; difficulty < difficultyCount; ++difficulty) {
+        if (name == difficultyTiers[difficulty].name) return static_cast<Difficulty>(difficulty);
+    }
+    return std::nullopt;
+}
+
+void engine::recordMoveTime(const Difficulty difficulty, const std::chrono::microseconds elapsed) {
+    static std::mutex mutex;
+    static std::ofstream file = [] {
+        const char *path = std::getenv("BATTLESHIP_MOVE_TIMINGS");
+        if (path == nullptr) return std::ofstream();
+
+        std::ofstream csv(path, std::ios::app);
+        if (csv.tellp() == 0) csv << "difficulty,budget_us,elapsed_us\n";
+        return csv;
+    }();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!file.is_open()) return;
+    file << difficultyTiers[difficulty].name << ',' << difficultyTiers[difficulty].budget.count() << ','
+         << elapsed.count() << '\n';
+    file.flush();
+}
@@ -0,0 +1,90 @@
+/**
+ * Difficulty tiers of the computer player: each tier is a strategy and the time each of its moves may take
+ */
+
+#ifndef BATTLESHIP_DIFFICULTY_H
+#define BATTLESHIP_DIFFICULTY_H
+
+#include "openingBook.hpp"
+#include "strategy.hpp"
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace engine {
+
+    /**
+     * The difficulty tiers, from the weakest computer player to the strongest
+     */
+    enum Difficulty { EASY,
+                      MEDIUM,
+                      HARD,
+                      EXPERT };
+
+    /**
+     * Number of difficulty tiers
+     */
+    constexpr int difficultyCount = 4;
+
+    /**
+     * How a tier decides its moves
+     */
+    enum class Search {
+        Random,    // RandomStrategy
+        HuntTarget,// HuntTargetStrategy
+        Counting,  // DensityStrategy, without finishing hit ships first
+        Sampling   // MonteCarloStrategy (anytime: counts positions first, then samples fleets until the budget runs out)
+    };
+
+    struct DifficultyTier {
+        // Lowercase name (used on the command line)
+        const char *name;
+
+        // How moves are decided
+        Search search;
+
+        // Most time a move may take (random and hunt/target moves take microseconds)
+        std::chrono::microseconds budget;
+
+        // If the tier plays the opening book's shots while the game is in it
+        bool openingBook;
+    };
+
+    /**
+     * Every tier, indexed by Difficulty
+     *
+     * Each tier searches differently rather than only getting more time, as time barely helps: sampling fleets sinks a
+     * fleet in about 52 shots whether a move samples a hundred fleets or for 100 ms
+     */
+    constexpr DifficultyTier difficultyTiers[difficultyCount] = {
+            {"easy", Search::Random, std::chrono::milliseconds(1), false},
+            {"medium", Search::HuntTarget, std::chrono::milliseconds(1), false},
+            {"hard", Search::Counting, std::chrono::milliseconds(1), true},
+            {"expert", Search::Sampling, std::chrono::milliseconds(100), true},
+    };
+
+    /**
+     * Returns a new computer player for a tier
+     *
+     * @param threads number of threads sampling fleets (if the tier samples fleets)
+     * @param book opening book for the tiers that use one (none if nullptr)
+     */
+    std::unique_ptr<Strategy> makeStrategy(Difficulty difficulty, unsigned threads = std::thread::hardware_concurrency(),
+                                           const std::shared_ptr<const OpeningBook> &book = nullptr);
+
+    /**
+     * Returns the tier with the given name, or nothing if there is no such tier
+     */
+    std::optional<Difficulty> difficultyFromName(const std::string &name);
+
+    /**
+     * Appends a move's timing to the CSV file named by the BATTLESHIP_MOVE_TIMINGS environment variable
+     * (tier, budget and time taken in microseconds). Does nothing if the variable isn't set
+     */
+    void recordMoveTime(Difficulty difficulty, std::chrono::microseconds elapsed);
+
+}// namespace engine
+
+#endif//BATTLESHIP_DIFFICULTY_H
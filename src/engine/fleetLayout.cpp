@@ -0,0 +1,103 @@
+/**
+ * Fleet layout generation
+ */
+
+#include "fleetLayout.hpp"
+#include "../helpers/gameHelpers.hpp"
+#include "placements.hpp"
+
+using engine::Fleet;
+using engine::FleetLayout;
+using entity::Grid;
+
+Fleet engine::randomFleet() {
+    // Every position a ship could be in is checked, so the candidates are kept on the stack
+    constexpr int maxPlacements = 2 * Grid::size * Grid::size;
+    uint8_t candidates[maxPlacements];
+
+    Fleet fleet{};
+    while (true) {
+        // Squares that are occupied by a ship or next to one
+        Bitboard blocked;
+        bool deployed = true;
+
+        for (shipNames ship : deploymentOrder) {
+            const PlacementList placements = shipPlacements(ship);
+
+            // Find the positions that don't overlap or touch the ships already deployed
+            int candidateCount = 0;
+            for (int i = 0; i < placements.size(); ++i) {
+                candidates[candidateCount] = (uint8_t) i;
+                candidateCount += (placements[i].squares & blocked).none();
+            }
+
+            // The ships deployed so far leave no room for this one (this never happens with the standard
+            // fleet, but is checked so the loop can't fail); start over
+            if (candidateCount == 0) {
+                deployed = false;
+                break;
+            }
+
+            const Placement &placement = placements[candidates[randomInt(0, candidateCount - 1)]];
+            fleet[static_cast<int>(ship)] = {placement.origin, placement.horizontal};
+            blocked |= placement.squares | placement.neighbours;
+        }
+
+        if (deployed) return fleet;
+    }
+}
+
+Fleet engine::uniformRandomFleet() {
+    Fleet fleet{};
+    while (true) {
+        Bitboard blocked;
+        bool deployed = true;
+
+        for (shipNames ship : deploymentOrder) {
+            const PlacementList placements = shipPlacements(ship);
+            const Placement &placement = placements[randomInt(0, placements.size() - 1)];
+
+            if ((placement.squares & blocked).any()) {// Overlaps or touches another ship; start over
+                deployed = false;
+                break;
+            }
+
+            fleet[static_cast<int>(ship)] = {placement.origin, placement.horizontal};
+            blocked |= placement.squares | placement.neighbours;
+        }
+
+        if (deployed) return fleet;
+    }
+}
+
+bool engine::legalFleet(const Fleet &fleet) {
+    Bitboard blocked;// Squares occupied by or next to the ships checked so far
+    for (int ship = 0; ship < shipCount; ++ship) {
+        const Placement &placement = placementAt(static_cast<shipNames>(ship), fleet[ship].origin, fleet[ship].horizontal);
+        if (placement.squares.none() || (placement.squares & blocked).any()) return false;
+        blocked |= placement.squares | placement.neighbours;
+    }
+    return true;
+}
+
+bool engine::legalFleet(const FleetLayout &layout) {
+    Bitboard blocked;
+    for (const auto &ship : layout) {
+        const Placement &placement = placementAt(ship.first, std::get<0>(ship.second), std::get<1>(ship.second));
+        if (placement.squares.none() || (placement.squares & blocked).any()) return false;
+        blocked |= placement.squares | placement.neighbours;
+    }
+    return true;
+}
+
+FleetLayout engine::randomFleetLayout() {
+    return toFleetLayout(uniformRandomFleet());
+}
+
+FleetLayout engine::toFleetLayout(const Fleet &fleet) {
+    FleetLayout layout;
+    for (int ship = 0; ship < shipCount; ++ship) {
+        layout[static_cast<shipNames>(ship)] = {fleet[ship].origin, fleet[ship].horizontal};
+    }
+    return layout;
+}
@@ -0,0 +1,73 @@
+/**
+ * Fleet layouts: where each ship of a fleet is located on a grid
+ */
+
+#ifndef BATTLESHIP_FLEETLAYOUT_H
+#define BATTLESHIP_FLEETLAYOUT_H
+
+#include "../entity/grid.hpp"
+#include <map>
+#include <tuple>
+
+using entity::Coordinate;
+using entity::shipCount;
+using entity::shipNames;
+using entity::ShipPosition;
+
+namespace engine {
+
+    // Orientation of ships: Its name, top left coordinate and if it's horizontal
+    typedef std::map<shipNames, std::tuple<Coordinate, bool>> FleetLayout;
+
+    // Position of every ship in a fleet, indexed by the ship's enum value (does not allocate)
+    typedef std::array<ShipPosition, shipCount> Fleet;
+
+    /**
+     * The order ships are deployed in when generating a layout (largest first)
+     */
+    constexpr shipNames deploymentOrder[shipCount] = {
+            shipNames::Battleship,
+            shipNames::AircraftCarrier,
+            shipNames::Destroyer,
+            shipNames::Submarine,
+            shipNames::PatrolBoat,
+            shipNames::RowBoat,
+    };
+
+    /**
+     * Generates a random fleet where no two ships are next to each other (ships may only touch diagonally)
+     *
+     * Ships are deployed in deploymentOrder, each at a uniformly random position among the positions still
+     * legal given the ships already deployed. Positions come from the precomputed placement tables, so no
+     * illegal position is ever tried and nothing is allocated
+     */
+    Fleet randomFleet();
+
+    /**
+     * Generates a random fleet where every legal fleet is equally likely, by rejection sampling
+     *
+     * randomFleet() favours fleets where the first ships leave little room for the rest. This draws every ship
+     * from all of its positions and rejects the whole fleet, starting over, as soon as a ship overlaps or touches
+     * another. An attempt is a handful of mask tests, but about 60 attempts are needed per fleet (about 6 us)
+     */
+    Fleet uniformRandomFleet();
+
+    /**
+     * Returns true if every ship fits on the grid and no two ships overlap or are next to each other
+     */
+    bool legalFleet(const Fleet &fleet);
+    bool legalFleet(const FleetLayout &layout);
+
+    /**
+     * Generates a random fleet layout where every legal fleet is equally likely (see uniformRandomFleet)
+     */
+    FleetLayout randomFleetLayout();
+
+    /**
+     * Converts a fleet to the equivalent fleet layout
+     */
+    FleetLayout toFleetLayout(const Fleet &fleet);
+
+}// namespace engine
+
+#endif//BATTLESHIP_FLEETLAYOUT_H
@@ -0,0 +1,49 @@
+/**
+ * Game class implementation
+ */
+
+#include "game.hpp"
+#include <stdexcept>
+
+using engine::Game;
+
+Game::Game() = default;
+
+Game::Game(const FleetLayout &fleetP1, const FleetLayout &fleetP2) {
+    setFleet(P1, fleetP1);
+    setFleet(P2, fleetP2);
+}
+
+void Game::setFleet(const Player player, const FleetLayout &fleet) {
+    if (!legalFleet(fleet)) {
+        throw std::invalid_argument("Ships must fit on the grid and may not overlap or be next to each other!");
+    }
+    grids[player] = Grid(fleet);
+}
+
+void Game::setFleet(const Player player, const Fleet &fleet) {
+    if (!legalFleet(fleet)) {
+        throw std::invalid_argument("Ships must fit on the grid and may not overlap or be next to each other!");
+    }
+    grids[player] = Grid(fleet);
+}
+
+SquareType Game::attack(const Player attacker, const Coordinate &coordinate) {
+    return grids[opponent(attacker)].attack(coordinate);
+}
+
+bool Game::lost(const Player player) const {
+    return grids[player].allSunk();
+}
+
+bool Game::over() const {
+    return lost(P1) || lost(P2);
+}
+
+Grid &Game::getGrid(const Player player) {
+    return grids[player];
+}
+
+const Grid &Game::getGrid(const Player player) const {
+    return grids[player];
+}
@@ -0,0 +1,81 @@
+/**
+ * Headless game rules: both players' grids and the attacks between them
+ * Does not depend on SFML, so full games can be simulated without a window
+ */
+
+#ifndef BATTLESHIP_GAME_H
+#define BATTLESHIP_GAME_H
+
+#include "../entity/grid.hpp"
+#include "fleetLayout.hpp"
+
+using entity::Grid;
+using entity::SquareType;
+
+namespace engine {
+
+    class Game {
+    public:
+        /**
+         * The two players: P1 and P2
+         */
+        enum Player { P1,
+                      P2 };
+
+        /**
+         * Starts a game where neither player has placed their fleet
+         */
+        Game();
+
+        /**
+         * Starts a game with both players' fleet layouts (throws std::invalid_argument if either isn't legal)
+         */
+        Game(const FleetLayout &fleetP1, const FleetLayout &fleetP2);
+
+        /**
+         * Places a player's fleet, resetting their grid
+         *
+         * Throws std::invalid_argument if the fleet isn't legal (see legalFleet)
+         */
+        void setFleet(Player player, const FleetLayout &fleet);
+        void setFleet(Player player, const Fleet &fleet);
+
+        /**
+         * Attacks the opponent of the given player at a coordinate
+         *
+         * Returns the status of the square before attacking (see Grid::attack). The attack only
+         * went through if the result is Water or Ship
+         */
+        SquareType attack(Player attacker, const Coordinate &coordinate);
+
+        /**
+         * Returns true if all the ships of the given player have been sunk
+         */
+        [[nodiscard]] bool lost(Player player) const;
+
+        /**
+         * Returns true if either player has lost
+         */
+        [[nodiscard]] bool over() const;
+
+        /**
+         * Returns the grid belonging to the given player
+         */
+        [[nodiscard]] Grid &getGrid(Player player);
+        [[nodiscard]] const Grid &getGrid(Player player) const;
+
+        /**
+         * Returns the other player
+         */
+        static constexpr Player opponent(const Player player) {
+            return player == P1 ? P2 : P1;
+        }
+
+    private:
+        // Each player's grid (indexed by Player)
+        Grid grids[2];
+    };
+
+}// namespace engine
+
+#endif//BATTLESHIP_GAME_H
@@ -0,0 +1,62 @@
+/**
+ * HuntTargetStrategy class implementation
+ */
+
+#include "huntTargetStrategy.hpp"
+#include "../helpers/gameHelpers.hpp"
+#include "placements.hpp"
+#include <stdexcept>
+
+using engine::HuntTargetStrategy;
+
+namespace {
+    // Returns a random square from a non-empty set
+    int randomSquare(Bitboard squares) {
+        for (int skip = randomInt(0, squares.count() - 1); skip > 0; --skip) {
+            squares.popLowest();
+        }
+        return squares.lowest();
+    }
+}// namespace
+
+Coordinate HuntTargetStrategy::nextTarget(const Grid &opponent) {
+    const Bitboard hits = opponent.getHitSquares();
+    const Bitboard sunk = opponent.getSunkSquares();
+    const Bitboard openHits = hits.andNot(sunk);// Hits on ships that are still afloat
+
+    // Squares that can't hold a ship that hasn't been found: already attacked or next to a sunk ship
+    const Bitboard ruledOut = hits | opponent.getMissSquares() | neighbourSquares(sunk);
+
+    // Target: attack next to the unsunk hits, along the ship's line if two of its squares are known
+    if (openHits.any()) {
+        Bitboard alongRows, alongColumns, around;
+        Bitboard remaining = openHits;
+        while (remaining.any()) {
+            const int square = remaining.popLowest();
+            const int x = square % Grid::size;
+            const int y = square / Grid::size;
+            const bool inRow = (x > 0 && openHits.test(square - 1)) || (x < Grid::size - 1 && openHits.test(square + 1));
+            const bool inColumn = (y > 0 && openHits.test(square - Grid::size)) || (y < Grid::size - 1 && openHits.test(square + Grid::size));
+
+            if (x > 0) (inRow ? alongRows : around).set(square - 1);
+            if (x < Grid::size - 1) (inRow ? alongRows : around).set(square + 1);
+            if (y > 0) (inColumn ? alongColumns : around).set(square - Grid::size);
+            if (y < Grid::size - 1) (inColumn ? alongColumns : around).set(square + Grid::size);
+        }
+
+        for (const Bitboard &candidates : {alongRows | alongColumns, around}) {
+            const Bitboard open = candidates.andNot(ruledOut);
+            if (open.any()) return Coordinate::fromIndex(randomSquare(open));
+        }
+    }
+
+    // Hunt: attack any square that could still hold a ship
+    Bitboard candidates = Grid::allSquares.andNot(ruledOut);
+    if (candidates.none()) {
+        candidates = Grid::allSquares.andNot(hits | opponent.getMissSquares());
+    }
+    if (candidates.none()) {
+        throw std::invalid_argument("Every square has been attacked- this game is in an impossible state!");
+    }
+    return Coordinate::fromIndex(randomSquare(candidates));
+}
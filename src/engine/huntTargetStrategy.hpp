@@ -0,0 +1,24 @@
+/**
+ * Computer player that attacks random squares until it hits a ship, then attacks the squares next to
+ * the hit until the ship is sunk (following the line of the ship once two squares of it have been hit)
+ */
+
+#ifndef BATTLESHIP_HUNTTARGETSTRATEGY_H
+#define BATTLESHIP_HUNTTARGETSTRATEGY_H
+
+#include "strategy.hpp"
+
+namespace engine {
+
+    class HuntTargetStrategy : public Strategy {
+    public:
+        /**
+         * Returns a square next to an unsunk hit if there is one, otherwise a random square that could
+         * still hold a ship
+         */
+        Coordinate nextTarget(const Grid &opponent) override;
+    };
+
+}// namespace engine
+
+#endif//BATTLESHIP_HUNTTARGETSTRATEGY_H
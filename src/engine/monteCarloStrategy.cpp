@@ -0,0 +1,238 @@
+/**
+ * MonteCarloStrategy class implementation
+ */
+
+#include "monteCarloStrategy.hpp"
+#include "../helpers/gameHelpers.hpp"
+#include "densityStrategy.hpp"
+#include "fleetLayout.hpp"
+#include "placements.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using engine::MonteCarloStrategy;
+using std::chrono::steady_clock;
+
+namespace {
+    constexpr int squareCount = Grid::size * Grid::size;
+
+    // Most positions any ship can be in
+    constexpr int maxPlacements = 2 * squareCount;
+
+    // Positions each ship still afloat can be in, given the hits, misses and sunk ships
+    struct Candidates {
+        // Ships still afloat, the ship with the fewest positions first
+        shipNames ships[entity::shipCount];
+        int shipCount = 0;
+
+        // Positions of each ship (indexed by the ship's enum value) that avoid the known empty squares
+        // and don't touch an unsunk hit
+        std::vector<engine::Placement> placements[entity::shipCount];
+
+        // Hits on ships that are still afloat (every sampled fleet has to cover them)
+        Bitboard openHits;
+
+        // Positions that cover each open hit: (ship's enum value, index in its placements)
+        std::vector<std::pair<uint8_t, uint16_t>> covering[squareCount];
+
+        explicit Candidates(const Grid &opponent) {
+            const Bitboard sunk = opponent.getSunkSquares();
+            const Bitboard blocked = opponent.getMissSquares() | sunk | engine::neighbourSquares(sunk);
+            openHits = opponent.getHitSquares().andNot(sunk);
+
+            for (shipNames ship : engine::deploymentOrder) {
+                if (opponent.isSunk(ship)) continue;
+                ships[shipCount++] = ship;
+
+                std::vector<engine::Placement> &positions = placements[static_cast<int>(ship)];
+                for (const engine::Placement &placement : engine::shipPlacements(ship)) {
+                    if ((placement.squares & blocked).none() && (placement.neighbours & openHits).none()) {
+                        Bitboard covered = placement.squares & openHits;
+                        while (covered.any()) {
+                            covering[covered.popLowest()].emplace_back((uint8_t) ship, (uint16_t) positions.size());
+                        }
+                        positions.push_back(placement);
+                    }
+                }
+            }
+
+            // Placing the most constrained ships first leaves them room far more often than placing
+            // the largest first (late in a game, the large ships may only have a couple of positions left)
+            std::stable_sort(ships, ships + shipCount, [this](const shipNames a, const shipNames b) {
+                return placements[static_cast<int>(a)].size() < placements[static_cast<int>(b)].size();
+            });
+        }
+    };
+
+    // Places every ship still afloat at a random position that doesn't overlap or touch the ships placed before it
+    // Ships are first placed over the open hits, lowest uncovered hit first, each drawn from every position of an
+    // unplaced ship that covers the hit, so hits are covered by construction rather than by chance. The rest follow,
+    // most constrained first. Returns false (and the fleet has to be sampled again) if a hit or ship has no room left
+    // The weight is the inverse of the chance of drawing this fleet (the product of the choices at each step): the
+    // ship covering each hit is unique, so there is one way to draw every fleet
+    bool sampleFleet(const Candidates &candidates, Bitboard &fleetSquares, double &weight) {
+        uint16_t free[maxPlacements];
+        Bitboard taken;// Squares occupied by or next to the ships placed so far
+        unsigned placed = 0;// Bit per ship enum value
+        fleetSquares = Bitboard();
+        weight = 1;
+
+        Bitboard uncovered = candidates.openHits;
+        while (uncovered.any()) {
+            const std::vector<std::pair<uint8_t, uint16_t>> &covering = candidates.covering[uncovered.lowest()];
+            int freeCount = 0;
+            for (int c = 0; c < (int) covering.size(); ++c) {
+                const auto [ship, position] = covering[c];
+                free[freeCount] = (uint16_t) c;
+                freeCount += ((placed >> ship) & 1) == 0 && (candidates.placements[ship][position].squares & taken).none();
+            }
+            if (freeCount == 0) return false;
+            weight *= freeCount;
+
+            const auto [ship, position] = covering[free[randomInt(0, freeCount - 1)]];
+            const engine::Placement &placement = candidates.placements[ship][position];
+            placed |= 1u << ship;
+            taken |= placement.squares | placement.neighbours;
+            fleetSquares |= placement.squares;
+            uncovered = uncovered.andNot(placement.squares);
+        }
+
+        for (int i = 0; i < candidates.shipCount; ++i) {
+            const int ship = static_cast<int>(candidates.ships[i]);
+            if ((placed >> ship) & 1) continue;
+
+            const std::vector<engine::Placement> &placements = candidates.placements[ship];
+            int freeCount = 0;
+            for (int p = 0; p < (int) placements.size(); ++p) {
+                free[freeCount] = (uint16_t) p;
+                freeCount += (placements[p].squares & taken).none();
+            }
+            if (freeCount == 0) return false;
+            weight *= freeCount;
+
+            const engine::Placement &placement = placements[free[randomInt(0, freeCount - 1)]];
+            taken |= placement.squares | placement.neighbours;
+            fleetSquares |= placement.squares;
+        }
+        return true;
+    }
+}// namespace
+
+MonteCarloStrategy::MonteCarloStrategy(const std::chrono::microseconds budget, const unsigned threads, const int sampleLimit)
+    : budget(budget), sampleLimit(sampleLimit) {
+    if (sampleLimit < 1) {
+        throw std::invalid_argument("At least one fleet has to be sampled for each decision!");
+    }
+    if (threads > 1) {
+        pool = std::make_unique<ThreadPool>(threads);
+    }
+}
+
+MonteCarloStrategy::Samples MonteCarloStrategy::sample(const Grid &opponent, const int limit, const steady_clock::time_point deadline,
+                                                      const std::atomic<bool> *cancelled) {
+    const Candidates candidates(opponent);
+    const Bitboard untried = Grid::allSquares.andNot(opponent.getHitSquares() | opponent.getMissSquares());
+
+    Samples samples;
+    while (samples.fleets < limit) {
+        // Checked before every attempt (reading the clock takes far less time than an attempt)
+        if (steady_clock::now() >= deadline || (cancelled != nullptr && *cancelled)) break;
+
+        Bitboard fleetSquares;
+        double weight;
+        if (!sampleFleet(candidates, fleetSquares, weight)) continue;
+
+        Bitboard occupied = fleetSquares & untried;
+        while (occupied.any()) {
+            samples.occupancy[occupied.popLowest()] += weight;
+        }
+        samples.fleets++;
+    }
+    return samples;
+}
+
+Coordinate MonteCarloStrategy::nextTarget(const Grid &opponent) {
+    const std::atomic<bool> never(false);
+    return cancellableNextTarget(opponent, never);
+}
+
+Coordinate MonteCarloStrategy::cancellableNextTarget(const Grid &opponent, const std::atomic<bool> &cancelled) {
+    // Sampling stops a quarter of the budget early, leaving time for workers that started late or were
+    // interrupted, and whatever a worker hasn't returned by the collection deadline is left out of the decision
+    const steady_clock::time_point start = steady_clock::now();
+    const steady_clock::time_point deadline = start + budget - budget / 4;
+    const steady_clock::time_point collection = start + budget - budget / 10;
+
+    // The move to make if there isn't time to sample enough fleets
+    const Coordinate counted = DensityStrategy().nextTarget(opponent);
+
+    Samples total;
+    if (pool == nullptr) {
+        total = sample(opponent, sampleLimit, deadline, &cancelled);
+    } else {
+        // Each worker gets its own random stream, seeded from this thread's so games can be replayed
+        const unsigned workers = pool->size();
+        const std::seed_seq::result_type seed = randomEngine()();
+        const int limit = (sampleLimit + (int) workers - 1) / (int) workers;
+
+        // Workers may outlive this decision (if they miss the collection deadline), so they share a copy of the
+        // grid and their own stop flag rather than anything on this stack
+        struct Shared {
+            Grid opponent;
+            std::atomic<bool> stop{false};
+        };
+        const auto shared = std::make_shared<Shared>();
+        shared->opponent = opponent;
+
+        std::vector<std::future<Samples>> results;
+        for (unsigned worker = 0; worker < workers; ++worker) {
+            results.push_back(pool->submit([shared, seed, worker, limit, deadline] {
+                seedRandom(seed, worker);
+                return sample(shared->opponent, limit, deadline, &shared->stop);
+            }));
+        }
+
+        // Wait for the workers in short steps, so a cancellation stops them at once
+        for (std::future<Samples> &result : results) {
+            while (result.wait_until(std::min(collection, steady_clock::now() + std::chrono::milliseconds(1))) != std::future_status::ready) {
+                if (cancelled || steady_clock::now() >= collection) {
+                    shared->stop = true;
+                    break;
+                }
+            }
+            if (result.wait_for(std::chrono::seconds(0)) != std::future_status::ready) continue;
+
+            const Samples samples = result.get();
+            for (int square = 0; square < squareCount; ++square) {
+                total.occupancy[square] += samples.occupancy[square];
+            }
+            total.fleets += samples.fleets;
+        }
+    }
+
+    // Out of time (or cancelled) before enough fleets were sampled, or no fleet fits the grid
+    if (total.fleets < std::min(minimumFleets, sampleLimit)) {
+        return counted;
+    }
+
+    // Pick the square occupied in the most samples, breaking ties at random so the computer isn't predictable
+    const Bitboard tried = opponent.getHitSquares() | opponent.getMissSquares();
+    int best = -1, ties = 0;
+    double bestCount = -1;
+    for (int square = 0; square < squareCount; ++square) {
+        if (tried.test(square)) continue;
+
+        if (total.occupancy[square] > bestCount) {
+            best = square;
+            bestCount = total.occupancy[square];
+            ties = 1;
+        } else if (total.occupancy[square] == bestCount && randomInt(0, ties++) == 0) {
+            best = square;
+        }
+    }
+    if (best == -1) {
+        throw std::invalid_argument("Every square has been attacked- this game is in an impossible state!");
+    }
+    return Coordinate::fromIndex(best);
+}
@@ -0,0 +1,94 @@
+/**
+ * Computer player that samples complete opponent fleets and attacks the square most of them have a ship on
+ *
+ * Each sample places every ship still afloat so that it avoids the misses and sunk ships, covers every
+ * unsunk hit and doesn't touch another ship (the rule fleets are placed with). Unlike DensityStrategy,
+ * which counts each ship's positions on their own, the samples account for the ships leaving room for
+ * each other. Ships are placed one at a time, starting with ships over the unsunk hits so the hits are covered by
+ * construction, and each fleet is weighted by how likely it was to be drawn to make every legal fleet count equally.
+ * Sampling is split across worker threads and stops when the time budget runs out
+ *
+ * Decisions are anytime: DensityStrategy's choice is worked out first (well under a millisecond), and is
+ * replaced by the samples' choice once enough fleets have been sampled, so a move is ready whatever the budget
+ */
+
+#ifndef BATTLESHIP_MONTECARLOSTRATEGY_H
+#define BATTLESHIP_MONTECARLOSTRATEGY_H
+
+#include "strategy.hpp"
+#include "threadPool.hpp"
+#include <array>
+#include <chrono>
+#include <memory>
+
+namespace engine {
+
+    class MonteCarloStrategy : public Strategy {
+    public:
+        /**
+         * Time a decision may take by default
+         */
+        static constexpr std::chrono::milliseconds defaultBudget{20};
+
+        /**
+         * Number of fleets sampled for a decision by default (fewer if the budget runs out first)
+         */
+        static constexpr int defaultSampleLimit = 20000;
+
+        /**
+         * Fewest sampled fleets whose choice is trusted over DensityStrategy's
+         */
+        static constexpr int minimumFleets = 200;
+
+        /**
+         * @param budget time each decision may take
+         * @param threads number of threads sampling fleets (1 samples on the calling thread)
+         * @param sampleLimit number of fleets after which a decision is made even if there is time left
+         */
+        explicit MonteCarloStrategy(std::chrono::microseconds budget = defaultBudget,
+                                    unsigned threads = std::thread::hardware_concurrency(),
+                                    int sampleLimit = defaultSampleLimit);
+
+        /**
+         * Returns the untried square with a ship in the most sampled fleets
+         * (decided by DensityStrategy if fewer than minimumFleets could be sampled in time)
+         */
+        Coordinate nextTarget(const Grid &opponent) override;
+
+        /**
+         * Same as nextTarget, but stops sampling as soon as cancelled is set
+         */
+        Coordinate cancellableNextTarget(const Grid &opponent, const std::atomic<bool> &cancelled) override;
+
+        /**
+         * Fleets sampled on one thread
+         */
+        struct Samples {
+            // Total weight of the sampled fleets with a ship on each untried square (indexed by y * Grid::size + x)
+            std::array<double, Grid::size * Grid::size> occupancy{};
+
+            // Number of fleets sampled
+            int fleets = 0;
+        };
+
+        /**
+         * Samples fleets consistent with the opponent's grid on the calling thread, until the limit is
+         * reached, the deadline has passed or cancelled is set
+         */
+        static Samples sample(const Grid &opponent, int limit, std::chrono::steady_clock::time_point deadline,
+                              const std::atomic<bool> *cancelled = nullptr);
+
+    private:
+        // Time each decision may take
+        std::chrono::microseconds budget;
+
+        // Number of fleets after which a decision is made
+        int sampleLimit;
+
+        // Threads sampling fleets (nullptr if sampling on the calling thread)
+        std::unique_ptr<ThreadPool> pool;
+    };
+
+}// namespace engine
+
+#endif//BATTLESHIP_MONTECARLOSTRATEGY_H
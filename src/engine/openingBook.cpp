@@ -0,0 +1,85 @@
+/**
+ * OpeningBook class implementation
+ */
+
+#include "openingBook.hpp"
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+using engine::OpeningBook;
+
+namespace {
+    constexpr char magic[4] = {'B', 'S', 'O', 'B'};
+}// namespace
+
+OpeningBook::OpeningBook(const std::vector<Coordinate> &shots) : shots(shots) {
+    Bitboard squares;
+    played.push_back(squares);
+    for (const Coordinate shot : shots) {
+        if (squares.test(shot.getIndex())) {
+            throw std::invalid_argument("An opening book can't shoot the same square twice!");
+        }
+        squares.set(shot.getIndex());
+        played.push_back(squares);
+    }
+}
+
+std::optional<Coordinate> OpeningBook::next(const Grid &opponent) const {
+    if (opponent.getHitSquares().any()) return std::nullopt;
+
+    const Bitboard misses = opponent.getMissSquares();
+    const int shot = misses.count();
+    if (shot >= (int) shots.size() || misses != played[shot]) return std::nullopt;
+    return shots[shot];
+}
+
+const std::vector<Coordinate> &OpeningBook::getShots() const {
+    return shots;
+}
+
+bool OpeningBook::empty() const {
+    return shots.empty();
+}
+
+bool OpeningBook::load(const std::string &path, OpeningBook &book) {
+    std::ifstream file(path, std::ios::binary);
+    return file && read(file, book);
+}
+
+bool OpeningBook::read(std::istream &input, OpeningBook &book) {
+    char header[6];
+    if (!input.read(header, sizeof(header)) || !std::equal(magic, magic + 4, header) || (uint8_t) header[4] != version) {
+        return false;
+    }
+
+    const int count = (uint8_t) header[5];
+    std::vector<Coordinate> shots;
+    Bitboard squares;
+    for (int i = 0; i < count; ++i) {
+        const int square = input.get();
+        if (square == std::char_traits<char>::eof() || square >= Grid::size * Grid::size || squares.test(square)) {
+            return false;
+        }
+        squares.set(square);
+        shots.push_back(Coordinate::fromIndex(square));
+    }
+
+    book = OpeningBook(shots);
+    return true;
+}
+
+bool OpeningBook::save(const std::string &path) const {
+    std::ofstream file(path, std::ios::binary);
+    return file && write(file);
+}
+
+bool OpeningBook::write(std::ostream &output) const {
+    output.write(magic, sizeof(magic));
+    output.put((char) version);
+    output.put((char) shots.size());
+    for (const Coordinate shot : shots) {
+        output.put((char) shot.getIndex());
+    }
+    return (bool) output;
+}
@@ -0,0 +1,85 @@
+/**
+ * Precomputed first shots against a fresh grid (built offline by battleship-openings)
+ *
+ * The book is the line of shots to make while every shot so far has missed: shot k is the square most likely
+ * to hold a ship after the first k shots of the book missed. Looking up the next shot is O(1)
+ *
+ * File format (all single bytes, so there is no byte order): the magic "BSOB", the format version, the number
+ * of shots, then each shot's square (y * Grid::size + x)
+ */
+
+#ifndef BATTLESHIP_OPENINGBOOK_H
+#define BATTLESHIP_OPENINGBOOK_H
+
+#include "../entity/grid.hpp"
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+using entity::Bitboard;
+using entity::Coordinate;
+using entity::Grid;
+
+namespace engine {
+
+    class OpeningBook {
+    public:
+        /**
+         * Version of the file format written by write()
+         */
+        static constexpr uint8_t version = 1;
+
+        /**
+         * Constructs an empty book (it never has a shot to make)
+         */
+        OpeningBook() = default;
+
+        /**
+         * Constructs a book from its line of shots
+         *
+         * Throws std::invalid_argument if a square is shot more than once
+         */
+        explicit OpeningBook(const std::vector<Coordinate> &shots);
+
+        /**
+         * Returns the book's next shot if the opponent's grid only has the book's first shots, all of them misses,
+         * or nothing if the game has left the book
+         */
+        [[nodiscard]] std::optional<Coordinate> next(const Grid &opponent) const;
+
+        /**
+         * Returns the line of shots
+         */
+        [[nodiscard]] const std::vector<Coordinate> &getShots() const;
+
+        /**
+         * Returns true if the book has no shots
+         */
+        [[nodiscard]] bool empty() const;
+
+        /**
+         * Reads a book from a file or stream
+         * Returns false (leaving the book unchanged) if it can't be read or isn't a valid book
+         */
+        static bool load(const std::string &path, OpeningBook &book);
+        static bool read(std::istream &input, OpeningBook &book);
+
+        /**
+         * Writes the book to a file or stream
+         * Returns false if it can't be written
+         */
+        [[nodiscard]] bool save(const std::string &path) const;
+        [[nodiscard]] bool write(std::ostream &output) const;
+
+    private:
+        // The line of shots
+        std::vector<Coordinate> shots;
+
+        // Squares of the first k shots (entry k), so whether a grid is still in the book is one comparison
+        std::vector<Bitboard> played;
+    };
+
+}// namespace engine
+
+#endif//BATTLESHIP_OPENINGBOOK_H
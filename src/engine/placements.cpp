@@ -0,0 +1,30 @@
+/**
+ * Placement tables: checks of the compile-time tables, and helpers that use them
+ */
+
+#include "placements.hpp"
+
+using entity::Grid;
+
+namespace {
+    // A ship of length n fits in (size - n + 1) * size positions in each orientation
+    constexpr int fittingPositions(const shipNames ship) {
+        const int length = shipSize(ship);
+        return (length == 1 ? 1 : 2) * (Grid::size - length + 1) * Grid::size;
+    }
+}// namespace
+
+static_assert(engine::shipPlacements(shipNames::RowBoat).size() == fittingPositions(shipNames::RowBoat));
+static_assert(engine::shipPlacements(shipNames::Battleship).size() == fittingPositions(shipNames::Battleship));
+static_assert(engine::placementAt(shipNames::Battleship, Coordinate::unchecked(5, 0), true).squares.none(),
+              "A ship that runs off the grid has no squares");
+static_assert(engine::placementAt(shipNames::PatrolBoat, Coordinate::unchecked(0, 0), false).neighbours.count() == 3);
+
+Bitboard engine::neighbourSquares(Bitboard squares) {
+    const Bitboard original = squares;
+    Bitboard neighbours;
+    while (squares.any()) {
+        neighbours |= placementTables::adjacentSquares[squares.popLowest()];
+    }
+    return neighbours.andNot(original);
+}
@@ -0,0 +1,169 @@
+/**
+ * Masks of every position a ship can be placed in on an empty grid, built at compile time
+ * Used to validate fleets and by the computer players to reason about where the remaining ships can be:
+ * whether a position is free is a single mask AND
+ */
+
+#ifndef BATTLESHIP_PLACEMENTS_H
+#define BATTLESHIP_PLACEMENTS_H
+
+#include "../entity/bitboard.hpp"
+#include "../entity/coordinate.hpp"
+#include "../entity/grid.hpp"
+#include "../enums/shipNames.hpp"
+#include "../helpers/gameHelpers.hpp"
+#include <array>
+
+using entity::Bitboard;
+using entity::Coordinate;
+using entity::shipNames;
+
+namespace engine {
+
+    struct Placement {
+        // Squares the ship occupies (empty if the ship doesn't fit on the grid in this position)
+        Bitboard squares;
+
+        // Squares orthogonally next to the ship (no other ship may occupy them)
+        Bitboard neighbours;
+
+        // Top/left square of the ship
+        Coordinate origin;
+
+        // If the ship is aligned horizontally
+        bool horizontal = false;
+    };
+
+    /**
+     * The positions a ship fits in on an empty grid (a view of a compile-time table)
+     */
+    class PlacementList {
+    public:
+        constexpr PlacementList(const Placement *first, const int count) : first(first), count(count) {}
+
+        [[nodiscard]] constexpr const Placement *begin() const { return first; }
+        [[nodiscard]] constexpr const Placement *end() const { return first + count; }
+        [[nodiscard]] constexpr int size() const { return count; }
+        constexpr const Placement &operator[](const int index) const { return first[index]; }
+
+    private:
+        const Placement *first;
+        int count;
+    };
+
+    namespace placementTables {
+        constexpr int squareCount = entity::Grid::size * entity::Grid::size;
+
+        // Most positions any ship can be in (a one-square ship has 100, longer ships fewer in each orientation)
+        constexpr int maxPlacements = 2 * squareCount;
+
+        // Returns the squares orthogonally next to a square
+        constexpr Bitboard adjacent(const int square) {
+            const int x = square % entity::Grid::size;
+            const int y = square / entity::Grid::size;
+            Bitboard mask;
+            if (x > 0) mask.set(square - 1);
+            if (x < entity::Grid::size - 1) mask.set(square + 1);
+            if (y > 0) mask.set(square - entity::Grid::size);
+            if (y < entity::Grid::size - 1) mask.set(square + entity::Grid::size);
+            return mask;
+        }
+
+        // Returns a ship's footprint and halo with its top/left square on the anchor (empty if it doesn't fit)
+        constexpr Placement build(const shipNames ship, const bool horizontal, const int anchor) {
+            const int length = shipSize(ship);
+            const int x = anchor % entity::Grid::size;
+            const int y = anchor / entity::Grid::size;
+
+            Placement placement{};
+            placement.origin = Coordinate::fromIndex(anchor);
+            placement.horizontal = horizontal;
+            if ((horizontal ? x : y) + length > entity::Grid::size) return placement;
+
+            for (int i = 0; i < length; ++i) {
+                const int square = horizontal ? anchor + i : anchor + i * entity::Grid::size;
+                placement.squares.set(square);
+                placement.neighbours |= adjacent(square);
+            }
+            placement.neighbours = placement.neighbours.andNot(placement.squares);
+            return placement;
+        }
+
+        // Every ship, orientation (0 = horizontal) and anchor square
+        typedef std::array<std::array<std::array<Placement, squareCount>, 2>, entity::shipCount> AnchorTable;
+
+        constexpr AnchorTable buildAnchorTable() {
+            AnchorTable table{};
+            for (int ship = 0; ship < entity::shipCount; ++ship) {
+                for (int orientation = 0; orientation < 2; ++orientation) {
+                    for (int anchor = 0; anchor < squareCount; ++anchor) {
+                        table[ship][orientation][anchor] = build(static_cast<shipNames>(ship), orientation == 0, anchor);
+                    }
+                }
+            }
+            return table;
+        }
+
+        inline constexpr AnchorTable anchors = buildAnchorTable();
+
+        // The positions each ship fits in, packed at the start of each row (horizontal first, row by row)
+        struct ShipTable {
+            std::array<std::array<Placement, maxPlacements>, entity::shipCount> placements{};
+            std::array<int, entity::shipCount> counts{};
+        };
+
+        constexpr ShipTable buildShipTable() {
+            ShipTable table{};
+            for (int ship = 0; ship < entity::shipCount; ++ship) {
+                // A one-square ship is the same in both orientations, so it is only listed once
+                const int orientations = shipSize(static_cast<shipNames>(ship)) == 1 ? 1 : 2;
+                for (int orientation = 0; orientation < orientations; ++orientation) {
+                    for (int anchor = 0; anchor < squareCount; ++anchor) {
+                        if (anchors[ship][orientation][anchor].squares.any()) {
+                            table.placements[ship][table.counts[ship]++] = anchors[ship][orientation][anchor];
+                        }
+                    }
+                }
+            }
+            return table;
+        }
+
+        inline constexpr ShipTable ships = buildShipTable();
+
+        // Squares orthogonally next to each square of the grid
+        constexpr std::array<Bitboard, squareCount> buildAdjacentTable() {
+            std::array<Bitboard, squareCount> table{};
+            for (int square = 0; square < squareCount; ++square) {
+                table[square] = adjacent(square);
+            }
+            return table;
+        }
+
+        inline constexpr std::array<Bitboard, squareCount> adjacentSquares = buildAdjacentTable();
+    }// namespace placementTables
+
+    /**
+     * Returns every position the given ship fits in on an empty grid
+     * (a one-square ship is only listed once, as a horizontal ship)
+     */
+    constexpr PlacementList shipPlacements(const shipNames ship) {
+        const int index = static_cast<int>(ship);
+        return {placementTables::ships.placements[index].data(), placementTables::ships.counts[index]};
+    }
+
+    /**
+     * Returns the position of a ship with its top/left square at the origin
+     * (its squares are empty if the ship doesn't fit on the grid there)
+     */
+    constexpr const Placement &placementAt(const shipNames ship, const Coordinate origin, const bool horizontal) {
+        return placementTables::anchors[static_cast<int>(ship)][horizontal ? 0 : 1][origin.getIndex()];
+    }
+
+    /**
+     * Returns the squares orthogonally next to any square in the given set (excluding the set itself)
+     */
+    Bitboard neighbourSquares(Bitboard squares);
+
+}// namespace engine
+
+#endif//BATTLESHIP_PLACEMENTS_H
@@ -0,0 +1,33 @@
+/**
+ * RandomStrategy class implementation
+ */
+
+#include "randomStrategy.hpp"
+#include "../helpers/gameHelpers.hpp"
+#include <stdexcept>
+
+using engine::RandomStrategy;
+
+RandomStrategy::RandomStrategy() : untried(), untriedCount(0) {
+    this->reset();
+}
+
+void RandomStrategy::reset() {
+    for (int square = 0; square < (int) this->untried.size(); ++square) {
+        this->untried[square] = (uint8_t) square;
+    }
+    this->untriedCount = (int) this->untried.size();
+}
+
+Coordinate RandomStrategy::nextTarget(const Grid &) {
+    if (this->untriedCount == 0) {
+        throw std::invalid_argument("Every square has been attacked- this game is in an impossible state!");
+    }
+
+    // Pick a random untried square, then move the last untried square into its slot
+    const int index = randomInt(0, this->untriedCount - 1);
+    const int square = this->untried[index];
+    this->untried[index] = this->untried[--this->untriedCount];
+
+    return Coordinate::fromIndex(square);
+}
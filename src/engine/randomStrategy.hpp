@@ -0,0 +1,41 @@
+/**
+ * Computer player that attacks random squares it has not attacked yet (easy difficulty)
+ */
+
+#ifndef BATTLESHIP_RANDOMSTRATEGY_H
+#define BATTLESHIP_RANDOMSTRATEGY_H
+
+#include "strategy.hpp"
+#include <array>
+#include <cstdint>
+
+namespace engine {
+
+    class RandomStrategy : public Strategy {
+    public:
+        /**
+         * Starts with every square of the grid available to attack
+         */
+        RandomStrategy();
+
+        /**
+         * Selects (and removes) a random coordinate from the coordinates that have not been attacked yet
+         */
+        Coordinate nextTarget(const Grid &opponent) override;
+
+        /**
+         * Makes every square of the grid available to attack again
+         */
+        void reset() override;
+
+    private:
+        // Squares (y * Grid::size + x) that can still be attacked are stored in the first untriedCount entries
+        std::array<uint8_t, Grid::size * Grid::size> untried;
+
+        // Number of squares that can still be attacked
+        int untriedCount;
+    };
+
+}// namespace engine
+
+#endif//BATTLESHIP_RANDOMSTRATEGY_H
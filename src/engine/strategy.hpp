@@ -0,0 +1,45 @@
+/**
+ * Base abstract class for computer players: decides which square to attack next
+ */
+
+#ifndef BATTLESHIP_STRATEGY_H
+#define BATTLESHIP_STRATEGY_H
+
+#include "../entity/grid.hpp"
+#include <atomic>
+
+using entity::Coordinate;
+using entity::Grid;
+
+namespace engine {
+
+    class Strategy {
+    public:
+        virtual ~Strategy() = default;
+
+        /**
+         * Returns the next coordinate to attack on the opponent's grid
+         *
+         * Strategies may only use information the player could see on the screen
+         * (hits, misses and sunk ships), never the location of ships still afloat
+         */
+        virtual Coordinate nextTarget(const Grid &opponent) = 0;
+
+        /**
+         * Same as nextTarget, but stops as soon as possible once cancelled is set (the coordinate returned
+         * is then meaningless). Used when deciding on another thread; strategies that decide in well under
+         * a frame don't need to override it
+         */
+        virtual Coordinate cancellableNextTarget(const Grid &opponent, const std::atomic<bool> & /*cancelled*/) {
+            return nextTarget(opponent);
+        }
+
+        /**
+         * Forgets everything about the previous game (call before every new game)
+         */
+        virtual void reset() {}
+    };
+
+}// namespace engine
+
+#endif//BATTLESHIP_STRATEGY_H
@@ -0,0 +1,44 @@
+/**
+ * ThreadPool class implementation
+ */
+
+#include "threadPool.hpp"
+#include <algorithm>
+
+using engine::ThreadPool;
+
+ThreadPool::ThreadPool(const unsigned threads) : stopping(false) {
+    for (unsigned i = 0; i < std::max(1u, threads); ++i) {
+        workers.emplace_back(&ThreadPool::work, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+}
+
+unsigned ThreadPool::size() const {
+    return (unsigned) workers.size();
+}
+
+void ThreadPool::work() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return stopping || !tasks.empty(); });
+            if (tasks.empty()) return;// Stopping, and nothing left to run
+
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
@@ -0,0 +1,79 @@
+/**
+ * Fixed set of worker threads that run submitted tasks in the order they were submitted
+ * Used by the computer players to split their work across cores
+ */
+
+#ifndef BATTLESHIP_THREADPOOL_H
+#define BATTLESHIP_THREADPOOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine {
+
+    class ThreadPool {
+    public:
+        /**
+         * Starts the given number of worker threads (at least one)
+         */
+        explicit ThreadPool(unsigned threads);
+
+        /**
+         * Finishes the tasks already submitted, then stops the worker threads
+         */
+        ~ThreadPool();
+
+        // Worker threads can't be copied
+        ThreadPool(const ThreadPool &source) = delete;
+        ThreadPool &operator=(const ThreadPool &source) = delete;
+
+        /**
+         * Queues a task to run on a worker thread
+         *
+         * @return a future holding the task's result (or the exception it threw)
+         */
+        template<typename Task>
+        auto submit(Task task) -> std::future<decltype(task())> {
+            auto packaged = std::make_shared<std::packaged_task<decltype(task())()>>(std::move(task));
+            std::future<decltype(task())> result = packaged->get_future();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                tasks.emplace_back([packaged] { (*packaged)(); });
+            }
+            wake.notify_one();
+            return result;
+        }
+
+        /**
+         * Returns the number of worker threads
+         */
+        [[nodiscard]] unsigned size() const;
+
+    private:
+        // Worker threads
+        std::vector<std::thread> workers;
+
+        // Tasks waiting for a worker (protected by mutex)
+        std::deque<std::function<void()>> tasks;
+
+        // Set when the pool is destroyed (protected by mutex)
+        bool stopping;
+
+        std::mutex mutex;
+
+        // Signalled when a task is queued or the pool is stopping
+        std::condition_variable wake;
+
+        // Runs queued tasks until the pool is stopping and the queue is empty
+        void work();
+    };
+
+}// namespace engine
+
+#endif//BATTLESHIP_THREADPOOL_H
@@ -0,0 +1,150 @@
+/**
+ * A fixed-width set of grid squares stored as a 128-bit mask (one bit per square)
+ * Square (x, y) is stored at bit index y * Grid::size + x
+ */
+
+#ifndef BATTLESHIP_BITBOARD_H
+#define BATTLESHIP_BITBOARD_H
+
+#include <cstdint>
+
+namespace entity {
+
+    class Bitboard {
+    public:
+        /**
+         * Initialize this bitboard with no squares set
+         */
+        constexpr Bitboard() : low(0), high(0) {}
+
+        /**
+         * Initialize this bitboard from its lower (squares 0-63) and upper (squares 64-127) words
+         */
+        constexpr Bitboard(uint64_t low, uint64_t high) : low(low), high(high) {}
+
+        /**
+         * Returns a bitboard with only the square at the given index set
+         */
+        static constexpr Bitboard square(const int index) {
+            return index < 64 ? Bitboard(uint64_t(1) << index, 0) : Bitboard(0, uint64_t(1) << (index - 64));
+        }
+
+        /**
+         * Returns a bitboard with the squares at indices 0 to count - 1 set (count is at most 128)
+         */
+        static constexpr Bitboard firstSquares(const int count) {
+            if (count <= 0) return {};
+            if (count < 64) return {(uint64_t(1) << count) - 1, 0};
+            if (count < 128) return {~uint64_t(0), (uint64_t(1) << (count - 64)) - 1};
+            return {~uint64_t(0), ~uint64_t(0)};
+        }
+
+        /**
+         * Returns true if the square at the given index is set
+         */
+        [[nodiscard]] constexpr bool test(const int index) const {
+            return index < 64 ? (low >> index) & 1 : (high >> (index - 64)) & 1;
+        }
+
+        /**
+         * Sets the square at the given index
+         */
+        constexpr void set(const int index) {
+            *this |= square(index);
+        }
+
+        /**
+         * Clears the square at the given index
+         */
+        constexpr void reset(const int index) {
+            *this = andNot(square(index));
+        }
+
+        /**
+         * Returns true if at least one square is set
+         */
+        [[nodiscard]] constexpr bool any() const {
+            return (low | high) != 0;
+        }
+
+        /**
+         * Returns true if no squares are set
+         */
+        [[nodiscard]] constexpr bool none() const {
+            return !any();
+        }
+
+        /**
+         * Returns the number of squares that are set
+         */
+        [[nodiscard]] constexpr int count() const {
+            return popCount(low) + popCount(high);
+        }
+
+        /**
+         * Returns the squares in this bitboard that are not in the other one
+         */
+        [[nodiscard]] constexpr Bitboard andNot(const Bitboard &other) const {
+            return {low & ~other.low, high & ~other.high};
+        }
+
+        /**
+         * Returns the index of the lowest set square (the bitboard must not be empty)
+         */
+        [[nodiscard]] int lowest() const {
+            return low != 0 ? trailingZeros(low) : 64 + trailingZeros(high);
+        }
+
+        /**
+         * Clears the lowest set square and returns its index (the bitboard must not be empty)
+         * Used to iterate over every set square: while (board.any()) { int i = board.popLowest(); ... }
+         */
+        int popLowest() {
+            const int index = lowest();
+            if (low != 0) {
+                low &= low - 1;
+            } else {
+                high &= high - 1;
+            }
+            return index;
+        }
+
+        constexpr Bitboard operator&(const Bitboard &rhs) const { return {low & rhs.low, high & rhs.high}; }
+        constexpr Bitboard operator|(const Bitboard &rhs) const { return {low | rhs.low, high | rhs.high}; }
+        constexpr Bitboard operator^(const Bitboard &rhs) const { return {low ^ rhs.low, high ^ rhs.high}; }
+
+        constexpr Bitboard &operator&=(const Bitboard &rhs) { return *this = *this & rhs; }
+        constexpr Bitboard &operator|=(const Bitboard &rhs) { return *this = *this | rhs; }
+        constexpr Bitboard &operator^=(const Bitboard &rhs) { return *this = *this ^ rhs; }
+
+        constexpr bool operator==(const Bitboard &rhs) const { return low == rhs.low && high == rhs.high; }
+        constexpr bool operator!=(const Bitboard &rhs) const { return !(*this == rhs); }
+
+    private:
+        // Squares 0-63
+        uint64_t low;
+
+        // Squares 64-127
+        uint64_t high;
+
+        // Number of set bits in a word (branch-free, usable at compile time)
+        static constexpr int popCount(uint64_t word) {
+            word = word - ((word >> 1) & 0x5555555555555555ULL);
+            word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+            word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+            return (int) ((word * 0x0101010101010101ULL) >> 56);
+        }
+
+        // Index of the lowest set bit of a non-zero word
+        static int trailingZeros(const uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctzll(word);
+#else
+            return popCount((word & (0 - word)) - 1);
+#endif
+        }
+    };
+
+}// namespace entity
+
+#endif//BATTLESHIP_BITBOARD_H
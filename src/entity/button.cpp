@@ -6,14 +6,17 @@
 
 using entity::Button;
 
-Button::Button(const sf::Vector2f position, const sf::Vector2f scale, sf::Texture &idleTexture, sf::Texture &activeTexture) {
+Button::Button(const sf::Vector2f position, const sf::Vector2f scale,
+               TextureRegion idleTexture, TextureRegion activeTexture) {
     this->active = false;
-    this->idleTexture.reset(&idleTexture);
-    this->activeTexture.reset(&activeTexture);
+    this->idleTexture = std::move(idleTexture);
+    this->activeTexture = std::move(activeTexture);
 
-    this->sprite = std::make_unique<sf::Sprite>(*this->idleTexture);
+    this->sprite = std::make_unique<sf::Sprite>();
+    this->idleTexture.applyTo(*this->sprite);
     this->sprite->setPosition(position);
     this->sprite->setScale(scale);
+    this->bounds = this->sprite->getGlobalBounds();
 }
 
 bool Button::getButtonState() const {
@@ -24,12 +27,18 @@ void Button::render(sf::RenderWindow &window) const {
     window.draw(*this->sprite);
 }
 
-void Button::updateButtonState(const sf::Vector2f mousePosition) {
-    if (this->sprite->getGlobalBounds().contains(mousePosition)) {// Mouse is on the button
-        this->active = true;
-        this->sprite->setTexture(*this->activeTexture);
-    } else {
-        this->active = false;
-        this->sprite->setTexture(*this->idleTexture);
-    }
+bool Button::contains(const sf::Vector2f point) const {
+    return this->bounds.contains(point);
+}
+
+bool Button::setButtonState(const bool isActive) {
+    if (this->active == isActive) return false;
+
+    this->active = isActive;
+    (this->active ? this->activeTexture : this->idleTexture).applyTo(*this->sprite);
+    return true;
+}
+
+bool Button::updateButtonState(const sf::Vector2f mousePosition) {
+    return this->setButtonState(this->contains(mousePosition));
 }
@@ -5,6 +5,7 @@
 #ifndef BATTLESHIP_BUTTON_H
 #define BATTLESHIP_BUTTON_H
 
+#include "textureRegion.hpp"
 #include <SFML/Graphics.hpp>
 
 namespace entity {
@@ -19,7 +20,7 @@ namespace entity {
          * @param idleTexture the texture of this button when the mouse is not hovering over it
          * @param activeTexture the texture of this button when the mouse is hovering over it
          */
-        Button(sf::Vector2f position, sf::Vector2f scale, sf::Texture &idleTexture, sf::Texture &activeTexture);
+        Button(sf::Vector2f position, sf::Vector2f scale, TextureRegion idleTexture, TextureRegion activeTexture);
 
         /**
          * Returns true if the button is active (i.e., the cursor is over the button)
@@ -31,23 +32,38 @@ namespace entity {
          */
         void render(sf::RenderWindow &window) const;
 
+        /**
+         * Returns true if a point is on the button
+         */
+        [[nodiscard]] bool contains(sf::Vector2f point) const;
+
+        /**
+         * Sets the button state and texture
+         * Returns true if the state changed (i.e. the button needs to be redrawn)
+         */
+        bool setButtonState(bool isActive);
+
         /**
          * Updates the button state and texture if the mouse is over the button
+         * Returns true if the state changed (i.e. the button needs to be redrawn)
          */
-        void updateButtonState(sf::Vector2f mousePosition);
+        bool updateButtonState(sf::Vector2f mousePosition);
 
     private:
         // Texture when the button does not have the mouse over it
-        std::unique_ptr<sf::Texture> idleTexture;
+        TextureRegion idleTexture;
 
         // Texture when the button has the mouse over it
-        std::unique_ptr<sf::Texture> activeTexture;
+        TextureRegion activeTexture;
 
         // Button sprite (the object that renders)
         std::unique_ptr<sf::Sprite> sprite;
 
         // Button state (true = active, false = idle)
         bool active;
+
+        // Area of the screen covered by the button (buttons don't move)
+        sf::FloatRect bounds;
     };
 
 }// namespace entity
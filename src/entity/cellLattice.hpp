@@ -0,0 +1,72 @@
+/**
+ * A regular lattice of equally sized cells on the screen (e.g. the targets of a grid)
+ * Finds the cell under a point in constant time instead of checking the bounds of every cell
+ */
+
+#ifndef BATTLESHIP_CELLLATTICE_H
+#define BATTLESHIP_CELLLATTICE_H
+
+#include <SFML/Graphics.hpp>
+
+namespace entity {
+
+    class CellLattice {
+    public:
+        /**
+         * Constructs a lattice
+         *
+         * @param origin the position of the top left corner of the first cell
+         * @param step the distance between the top left corners of neighbouring cells
+         * @param cellSize the size of each cell (at most the step, the rest is a gap between cells)
+         * @param columns the number of cells in each row
+         * @param rows the number of rows
+         */
+        CellLattice(const sf::Vector2f origin, const sf::Vector2f step, const sf::Vector2f cellSize, const int columns, const int rows)
+            : origin(origin), step(step), cellSize(cellSize), columns(columns), rows(rows) {}
+
+        /**
+         * Returns the index (row * columns + column) of the cell under a point, or -1 if the point is not on a cell
+         */
+        [[nodiscard]] int cellAt(const sf::Vector2f point) const {
+            const float x = (point.x - origin.x) / step.x;
+            const float y = (point.y - origin.y) / step.y;
+            if (x < 0 || y < 0 || x >= (float) columns || y >= (float) rows) return -1;
+
+            const int column = (int) x, row = (int) y;
+            // Points in the gap between cells are not on a cell
+            if (point.x - origin.x - (float) column * step.x >= cellSize.x) return -1;
+            if (point.y - origin.y - (float) row * step.y >= cellSize.y) return -1;
+            return row * columns + column;
+        }
+
+        /**
+         * Returns the position of the top left corner of a cell
+         */
+        [[nodiscard]] sf::Vector2f cellPosition(const int cell) const {
+            return {origin.x + (float) (cell % columns) * step.x, origin.y + (float) (cell / columns) * step.y};
+        }
+
+        /**
+         * Returns the number of cells
+         */
+        [[nodiscard]] int size() const {
+            return columns * rows;
+        }
+
+    private:
+        // Position of the first cell
+        sf::Vector2f origin;
+
+        // Distance between neighbouring cells
+        sf::Vector2f step;
+
+        // Size of each cell
+        sf::Vector2f cellSize;
+
+        // Number of cells in each row and number of rows
+        int columns, rows;
+    };
+
+}// namespace entity
+
+#endif// BATTLESHIP_CELLLATTICE_H
@@ -1,12 +1,20 @@
 /**
  * A coordinate objects stores an x and y position in the range [0, 9]
  * Used to refer to squares on the battleship board
+ *
+ * The position is packed into a single byte (y * 10 + x), so coordinates are cheap to copy,
+ * compare and hash
  */
 
 #ifndef BATTLESHIP_COORDINATE_H
 #define BATTLESHIP_COORDINATE_H
 
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
 
 using std::ostream;
 
@@ -17,55 +25,112 @@ namespace entity {
         /**
          * Initialize this coordinate with a position of (0, 0)
          */
-        Coordinate();
+        constexpr Coordinate() : index(0) {}
 
         /**
          * Initialize this coordinate with a specified x and y value
+         *
+         * Throws a CoordinateException if x or y is outside the range [0, 9]
          */
-        Coordinate(int x, int y);
+        constexpr Coordinate(const int x, const int y) : index((uint8_t) (y * width + x)) {
+            if (!isValid(x, y)) throwOutOfRange(x, y);
+        }
+
+        /**
+         * Returns a coordinate with a specified x and y value, or nothing if x or y is outside the range [0, 9]
+         * Use this for values that come from outside the game engine
+         */
+        static constexpr std::optional<Coordinate> create(const int x, const int y) noexcept {
+            if (!isValid(x, y)) return std::nullopt;
+            return Coordinate((uint8_t) (y * width + x));
+        }
+
+        /**
+         * Returns a coordinate with a specified x and y value without validating them
+         * Only use this when x and y are known to be in the range [0, 9]
+         */
+        static constexpr Coordinate unchecked(const int x, const int y) noexcept {
+            return Coordinate((uint8_t) (y * width + x));
+        }
+
+        /**
+         * Returns the coordinate of a square index (y * 10 + x) without validating it
+         * Only use this when the index is known to be in the range [0, 99]
+         */
+        static constexpr Coordinate fromIndex(const int index) noexcept {
+            return Coordinate((uint8_t) index);
+        }
+
+        /**
+         * Returns true if x and y are both in the range [0, 9]
+         */
+        static constexpr bool isValid(const int x, const int y) noexcept {
+            return (unsigned) x < width && (unsigned) y < width;
+        }
 
         /**
          * Returns the x position of this coordinate
          */
-        [[nodiscard]] int getX() const;
+        [[nodiscard]] constexpr int getX() const { return index % width; }
 
         /**
          * Returns the y position of this coordinate
          */
-        [[nodiscard]] int getY() const;
+        [[nodiscard]] constexpr int getY() const { return index / width; }
 
         /**
-         * Returns true if both coordinates have the same x and y values
+         * Returns the index of this coordinate's square on the board (y * 10 + x)
          */
-        bool operator==(const Coordinate &rhs) const;
+        [[nodiscard]] constexpr int getIndex() const { return index; }
 
         /**
-         * Returns true if this coordinate's x OR y is less than the other coordinates'
-         * x or y respectively
+         * Returns true if both coordinates have the same x and y values
          */
-        bool operator<(const Coordinate &rhs) const;
+        constexpr bool operator==(const Coordinate &rhs) const { return index == rhs.index; }
+        constexpr bool operator!=(const Coordinate &rhs) const { return index != rhs.index; }
 
         /**
-         * Outputs this coordinate in the form (x, y)
+         * Orders coordinates row by row: by y first, then by x
          */
-        friend ostream &operator<<(std::ostream &output, const Coordinate &coord);
+        constexpr bool operator<(const Coordinate &rhs) const { return index < rhs.index; }
 
     private:
-        // Coordinate x position
-        int x;
+        // Number of squares in each row of the board
+        static constexpr int width = 10;
+
+        // Position of the square on the board (y * width + x)
+        uint8_t index;
 
-        // Coordinate y position
-        int y;
+        // Initialize this coordinate from a square index
+        constexpr explicit Coordinate(const uint8_t index) : index(index) {}
+
+        // Reports an invalid x or y value (kept out of line so the constructor stays small)
+        [[noreturn]] static void throwOutOfRange(int x, int y);
     };
 
-    class CoordinateException : std::exception {
+    /**
+     * Outputs a coordinate in the form (x, y)
+     */
+    ostream &operator<<(std::ostream &output, const Coordinate &coord);
+
+    class CoordinateException : public std::exception {
     public:
-        explicit CoordinateException(const char *message);
+        explicit CoordinateException(std::string message);
         [[nodiscard]] const char *what() const noexcept override;
 
     private:
-        const char *errorMessage;
+        std::string errorMessage;
     };
 }// namespace entity
 
+/**
+ * Hashes a coordinate by its square index, so coordinates can be stored in unordered containers
+ */
+template<>
+struct std::hash<entity::Coordinate> {
+    std::size_t operator()(const entity::Coordinate &coord) const noexcept {
+        return (std::size_t) coord.getIndex();
+    }
+};
+
 #endif//BATTLESHIP_COORDINATE_H
@@ -3,7 +3,8 @@
  */
 
 #include "grid.hpp"
-#include "../helpers/helperFunctions.hpp"
+#include "../helpers/gameHelpers.hpp"
+#include <stdexcept>
 
 using entity::Coordinate;
 using entity::Grid;
@@ -11,79 +12,107 @@ using entity::shipNames;
 using entity::SquareType;
 using std::get;
 
-entity::Grid::Grid() = default;
+entity::Grid::Grid() : hitCounts(), shipOrigins(), horizontalShips(0), placedShips(0), sunkShips(0) {
+    squareShips.fill(noShip);
+}
 
-Grid::Grid(const map<shipNames, tuple<Coordinate, bool>> &shipPositions) {
-    // Initialize the grid itself with all water to start
-    for (int i = 0; i < size; ++i) {
-        squares.emplace_back(vector<SquareType>());
-        for (int j = 0; j < size; ++j) {
-            squares[i].push_back(Water);
-        }
+Grid::Grid(const map<shipNames, tuple<Coordinate, bool>> &shipPositions) : Grid() {
+    for (auto const &ship : shipPositions) {
+        placeShip(static_cast<int>(ship.first), get<0>(ship.second), get<1>(ship.second));
     }
+}
 
-    // Create the ship objects
-    for (auto const &ship : shipPositions) {
-        // Information about the ship
-        shipNames shipName = ship.first;
-        int x = get<0>(ship.second).getX();         // Topmost/leftmost x coordinate
-        int y = get<0>(ship.second).getY();         // Topmost/leftmost y coordinate
-        const bool horizontal = get<1>(ship.second);// If the ship is aligned horizontally
-        const int length = shipSize(shipName);      // Number of squares in this ship
-
-        // Array of coordinates this ship occupies
-        vector<Coordinate> &coordinates = get<0>(ships[shipName]);
-        coordinates = vector<Coordinate>(length);
-
-        // Initializes the squares the ship occupies (from the top/left)
-        for (int i = 0; i < length; ++i) {
-            coordinates[i] = Coordinate(x, y);
-            squares[y][x] = Ship;
-            horizontal ? x++ : y++;
-        }
+Grid::Grid(const std::array<ShipPosition, shipCount> &ships) : Grid() {
+    for (int ship = 0; ship < shipCount; ++ship) {
+        placeShip(ship, ships[ship].origin, ships[ship].horizontal);
+    }
+}
+
+void Grid::placeShip(const int shipIndex, const Coordinate origin, const bool horizontal) {
+    int x = origin.getX();                                         // Topmost/leftmost x coordinate
+    int y = origin.getY();                                         // Topmost/leftmost y coordinate
+    const int length = shipSize(static_cast<shipNames>(shipIndex));// Number of squares in this ship
 
-        get<1>(ships[shipName]) = 0;   // Initialize hit count to 0
-        shipStatuses[shipName] = false;// Initialize the ship as 'not sunk'
+    // Marks the squares the ship occupies (from the top/left)
+    Bitboard &mask = shipMasks[shipIndex];
+    for (int i = 0; i < length; ++i) {
+        mask.set(squareIndex(x, y));
+        squareShips[squareIndex(x, y)] = (int8_t) shipIndex;
+        horizontal ? x++ : y++;
     }
+    shipSquares |= mask;
 
-    this->shipPositions = shipPositions;
+    shipOrigins[shipIndex] = origin;
+    horizontalShips |= horizontal << shipIndex;
+    placedShips |= 1 << shipIndex;
 }
 
-SquareType Grid::attack(Coordinate &coord) {
+SquareType Grid::attack(const Coordinate &coord) {
     // Determine the type of the square
-    SquareType &status = squares[coord.getY()][coord.getX()];
-    if (status == Water) {// We need to note if water has been hit
-        status = HitWater;
+    const int square = coord.getIndex();
+    if (hitSquares.test(square)) {// Already hit (do nothing)
+        return HitShip;
+    } else if (missSquares.test(square)) {
+        return HitWater;
+    } else if (!shipSquares.test(square)) {// We need to note if water has been hit
+        missSquares.set(square);
         return Water;
-    } else if (status != Ship) {// HitShip or HitWater (do nothing)
-        return status;
     }
 
-    // If it's not water or an already hit square, it is a ship. Find which ship it is and update it
-    status = HitShip;
-    for (auto const &ship : this->ships) {
-        shipNames shipName = ship.first;
-        int &hitCount = get<1>(ships[shipName]);
-
-        // Loop through the squares in this ship to see if it was hit
-        vector<Coordinate> coordinates = get<0>(ship.second);
-        for (int i = 0; i < shipSize(shipName); ++i) {
-            if (coordinates[i] == coord) {// Found it!
-                hitCount++;
-                if (hitCount == shipSize(shipName)) {
-                    shipStatuses[shipName] = true;// Ship has been sunk
-                }
-                return Ship;
-            }
+    // If it's not water or an already hit square, it is a ship. Look up which ship it is and update it
+    const int ship = squareShips[square];
+    if (ship == noShip) {
+        throw std::invalid_argument("Ship was not found- this game is in an impossible state!");
+    }
+    hitSquares.set(square);
+    if (++hitCounts[ship] == shipSize(static_cast<shipNames>(ship))) {
+        sunkShips |= 1 << ship;// Ship has been sunk
+    }
+    return Ship;
+}
+
+map<shipNames, tuple<Coordinate, bool>> entity::Grid::getShips() const {
+    map<shipNames, tuple<Coordinate, bool>> ships;
+    for (int ship = 0; ship < shipCount; ++ship) {
+        if (placedShips & (1 << ship)) {
+            ships[static_cast<shipNames>(ship)] = {shipOrigins[ship], (horizontalShips >> ship) & 1};
         }
     }
-    throw std::invalid_argument("Ship was not found- this game is in an impossible state!");
+    return ships;
 }
 
-map<shipNames, tuple<Coordinate, bool>> &entity::Grid::getShips() {
-    return this->shipPositions;
+map<shipNames, bool> Grid::getShipStatus() const {
+    map<shipNames, bool> statuses;
+    for (int ship = 0; ship < shipCount; ++ship) {
+        if (placedShips & (1 << ship)) {
+            statuses[static_cast<shipNames>(ship)] = (sunkShips >> ship) & 1;
+        }
+    }
+    return statuses;
+}
+
+bool Grid::isSunk(const shipNames ship) const {
+    return (sunkShips >> static_cast<int>(ship)) & 1;
+}
+
+bool Grid::allSunk() const {
+    return sunkShips == placedShips;
 }
 
-map<shipNames, bool> &Grid::getShipStatus() {
-    return this->shipStatuses;
+entity::Bitboard Grid::getHitSquares() const {
+    return this->hitSquares;
+}
+
+entity::Bitboard Grid::getMissSquares() const {
+    return this->missSquares;
+}
+
+entity::Bitboard Grid::getSunkSquares() const {
+    Bitboard squares;
+    for (int ship = 0; ship < shipCount; ++ship) {
+        if (sunkShips & (1 << ship)) {
+            squares |= shipMasks[ship];
+        }
+    }
+    return squares;
 }
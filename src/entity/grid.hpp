@@ -7,7 +7,10 @@
 
 #include "../enums/shipNames.hpp"
 #include "../enums/squareType.hpp"
+#include "bitboard.hpp"
 #include "coordinate.hpp"
+#include <array>
+#include <cstdint>
 #include <map>
 #include <vector>
 
@@ -17,18 +20,29 @@ using std::vector;
 
 namespace entity {
 
+    /**
+     * Where a ship is on a grid: its top/left coordinate and if it is horizontal
+     */
+    struct ShipPosition {
+        Coordinate origin;
+        bool horizontal;
+    };
+
     class Grid {
     public:
         /**
          * Constructs a grid with a list of ships
          *
-         * @param ships the six ships on the grid with their orientations
-         * @param isEnvironment if this is not for a real player, but for the environment
          * @param ships the six ships on the grid with their orientations in the form
          *              nameOfShip: (topLeftCoordinate, isHorizontal)
          */
         explicit Grid(const map<shipNames, tuple<Coordinate, bool>> &shipOrientations);
 
+        /**
+         * Constructs a grid with all six ships (indexed by their enum value) without allocating
+         */
+        explicit Grid(const std::array<ShipPosition, shipCount> &ships);
+
         /**
          * Tries to attack a grid square
          *
@@ -38,18 +52,43 @@ namespace entity {
          * 2. If the square is a ship, change it to a hit ship and update the ship that was hit
          * 3. If the square is a hit ship (or hit water), do nothing (attack doesn't go through)
          */
-        SquareType attack(Coordinate &coord);
+        SquareType attack(const Coordinate &coord);
 
         /**
          * Returns the location of each ship on this board
          * (top-left square and if it is horizontal)
          */
-        map<shipNames, tuple<Coordinate, bool>> &getShips();
+        [[nodiscard]] map<shipNames, tuple<Coordinate, bool>> getShips() const;
 
         /**
          * Returns the status (whether it has been sunk) of each ship on the board
          */
-        map<shipNames, bool> &getShipStatus();
+        [[nodiscard]] map<shipNames, bool> getShipStatus() const;
+
+        /**
+         * Returns true if the given ship has been sunk
+         */
+        [[nodiscard]] bool isSunk(shipNames ship) const;
+
+        /**
+         * Returns true if every ship on this board has been sunk
+         */
+        [[nodiscard]] bool allSunk() const;
+
+        /**
+         * Returns the ship squares that have been attacked
+         */
+        [[nodiscard]] Bitboard getHitSquares() const;
+
+        /**
+         * Returns the water squares that have been attacked
+         */
+        [[nodiscard]] Bitboard getMissSquares() const;
+
+        /**
+         * Returns the squares of every ship that has been sunk
+         */
+        [[nodiscard]] Bitboard getSunkSquares() const;
 
         /**
          * Default, empty constructor
@@ -61,31 +100,58 @@ namespace entity {
          */
         static constexpr int size = 10;
 
-    private:
         /**
-         * The six ships on this board
-         * This map maps the six ships (their enumerated name) to:
-         *  -The coordinates it occupies on the board
-         *  -The number of hits on this ship
+         * Every square of the grid
          */
-        map<shipNames, tuple<vector<Coordinate>, int>> ships;
+        static constexpr Bitboard allSquares = Bitboard::firstSquares(size * size);
+
+    private:
+        // Squares occupied by any ship
+        Bitboard shipSquares;
+
+        // Ship squares that have been attacked
+        Bitboard hitSquares;
+
+        // Water squares that have been attacked
+        Bitboard missSquares;
+
+        // Squares occupied by each ship (indexed by the ship's enum value)
+        std::array<Bitboard, shipCount> shipMasks;
+
+        // The ship (enum value) occupying each square, or noShip for water
+        std::array<int8_t, size * size> squareShips;
+
+        // Number of hits on each ship (indexed by the ship's enum value)
+        std::array<uint8_t, shipCount> hitCounts;
+
+        // Value in squareShips for squares without a ship
+        static constexpr int8_t noShip = -1;
 
         /**
          * Each ship with its top/left coordinate and whether it is horizontal or not
          * Used to render the ships to the screens
          */
-        map<shipNames, tuple<Coordinate, bool>> shipPositions;
+        std::array<Coordinate, shipCount> shipOrigins;
 
-        /**
-         * Whether each ship has been sunk or not
-         * USed to determine if the game has been finished and what ships have been sunk
-         */
-        map<shipNames, bool> shipStatuses;
+        // Ships that are horizontal (one bit per ship, indexed by the ship's enum value)
+        uint8_t horizontalShips;
+
+        // Ships that are on this board (one bit per ship)
+        uint8_t placedShips;
 
         /**
-         * 10-by-10 array of grid squares
+         * Ships that have been sunk (one bit per ship)
+         * Used to determine if the game has been finished and what ships have been sunk
          */
-        vector<vector<SquareType>> squares;
+        uint8_t sunkShips;
+
+        // Adds a ship to this board (every square it covers must be water)
+        void placeShip(int shipIndex, Coordinate origin, bool horizontal);
+
+        // Returns the bit index of a coordinate on this board
+        static constexpr int squareIndex(int x, int y) {
+            return y * size + x;
+        }
     };
 }// namespace entity
 
@@ -0,0 +1,43 @@
+/**
+ * LayerCache class implementation
+ */
+
+#include "layerCache.hpp"
+
+using entity::LayerCache;
+
+LayerCache::LayerCache() : outdated(true), cachedKey(0), unsupported(false) {}
+
+void LayerCache::invalidate() {
+    this->outdated = true;
+}
+
+void LayerCache::render(sf::RenderTarget &target, const int key, const std::function<void(sf::RenderTarget &)> &drawLayer) {
+    if (this->texture == nullptr && !this->unsupported) {
+        this->texture = std::make_unique<sf::RenderTexture>();
+        if (!this->texture->create(target.getSize().x, target.getSize().y)) {
+            this->texture = nullptr;
+            this->unsupported = true;
+        }
+    }
+    if (this->unsupported) {
+        drawLayer(target);
+        return;
+    }
+
+    if (this->outdated || key != this->cachedKey) {
+        this->texture->clear(sf::Color::Transparent);
+        this->texture->setView(target.getView());
+        drawLayer(*this->texture);
+        this->texture->display();
+
+        this->outdated = false;
+        this->cachedKey = key;
+    }
+
+    // The cache covers the whole target, draw it in target pixels
+    const sf::View view = target.getView();
+    target.setView(target.getDefaultView());
+    target.draw(sf::Sprite(this->texture->getTexture()));
+    target.setView(view);
+}
@@ -0,0 +1,52 @@
+/**
+ * Front-end class that caches a layer of a screen that rarely changes (e.g. the background and the ships) in a
+ * render texture, so each frame draws one full-screen quad instead of every sprite of the layer
+ */
+
+#ifndef BATTLESHIP_LAYERCACHE_H
+#define BATTLESHIP_LAYERCACHE_H
+
+#include <SFML/Graphics.hpp>
+#include <functional>
+#include <memory>
+
+namespace entity {
+
+    class LayerCache {
+    public:
+        /**
+         * Constructs an empty cache (the render texture is created when the layer is first drawn)
+         */
+        LayerCache();
+
+        /**
+         * Marks the cached layer as out of date so it is drawn again next time
+         */
+        void invalidate();
+
+        /**
+         * Draws the layer to the target, redrawing the cached layer first if it is out of date
+         *
+         * @param target where to draw the layer (e.g. the window)
+         * @param key identifies what the layer shows (e.g. which player's fleet): the layer is redrawn when it changes
+         * @param drawLayer draws the layer's sprites to the cache
+         */
+        void render(sf::RenderTarget &target, int key, const std::function<void(sf::RenderTarget &)> &drawLayer);
+
+    private:
+        // The cached layer (nullptr until it is first drawn, or if render textures aren't supported)
+        std::unique_ptr<sf::RenderTexture> texture;
+
+        // True if the cached layer has to be drawn again
+        bool outdated;
+
+        // Key of the cached layer
+        int cachedKey;
+
+        // Set if a render texture couldn't be created: the layer is then drawn directly every frame
+        bool unsupported;
+    };
+
+}// namespace entity
+
+#endif// BATTLESHIP_LAYERCACHE_H
@@ -0,0 +1,38 @@
+/**
+ * MarkerBoard class implementation
+ */
+
+#include "markerBoard.hpp"
+
+using entity::MarkerBoard;
+
+MarkerBoard::MarkerBoard() : layer(capacity) {}
+
+void MarkerBoard::add(const Coordinate coordinate, const TextureRegion &region, const sf::Vector2f position, const sf::Vector2f scale) {
+    this->squares.set(coordinate.getIndex());
+    this->layer.set(coordinate.getIndex(), region, position, scale);
+}
+
+void MarkerBoard::clear() {
+    while (this->squares.any()) {
+        this->layer.clear(this->squares.popLowest());
+    }
+}
+
+int MarkerBoard::size() const {
+    return this->squares.count();
+}
+
+bool MarkerBoard::empty() const {
+    return this->squares.none();
+}
+
+bool MarkerBoard::contains(const Coordinate coordinate) const {
+    return this->squares.test(coordinate.getIndex());
+}
+
+void MarkerBoard::render(sf::RenderTarget &target) const {
+    if (this->squares.any()) {
+        this->layer.render(target);
+    }
+}
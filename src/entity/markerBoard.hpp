@@ -0,0 +1,71 @@
+/**
+ * Front-end class that stores and draws the hit and miss markers of one grid
+ *
+ * Storage is allocated once for every square of the grid, so adding, clearing and drawing markers never allocates
+ */
+
+#ifndef BATTLESHIP_MARKERBOARD_H
+#define BATTLESHIP_MARKERBOARD_H
+
+#include "bitboard.hpp"
+#include "coordinate.hpp"
+#include "spriteBatch.hpp"
+
+namespace entity {
+
+    class MarkerBoard {
+    public:
+        // Most markers a board can hold (one per square)
+        static constexpr int capacity = 100;
+
+        /**
+         * Constructs an empty board
+         */
+        MarkerBoard();
+
+        /**
+         * Shows a marker on a square (replacing the marker already on it)
+         *
+         * @param coordinate the square of the marker
+         * @param region the texture of the marker (e.g. hit or miss)
+         * @param position the position of the marker on the screen
+         * @param scale a vector to scale the marker by
+         */
+        void add(Coordinate coordinate, const TextureRegion &region, sf::Vector2f position, sf::Vector2f scale);
+
+        /**
+         * Removes every marker
+         */
+        void clear();
+
+        /**
+         * Returns the number of markers on the board
+         */
+        [[nodiscard]] int size() const;
+
+        /**
+         * Returns true if there are no markers on the board
+         */
+        [[nodiscard]] bool empty() const;
+
+        /**
+         * Returns true if there is a marker on the square
+         */
+        [[nodiscard]] bool contains(Coordinate coordinate) const;
+
+        /**
+         * Draws every marker in a single call
+         */
+        void render(sf::RenderTarget &target) const;
+
+    private:
+        // Squares that have a marker
+        Bitboard squares;
+
+        // Markers to draw (slot = square index)
+        SpriteBatch layer;
+    };
+
+}// namespace entity
+
+#endif// BATTLESHIP_MARKERBOARD_H
@@ -0,0 +1,90 @@
+/**
+ * SpriteBatch class implementation
+ */
+
+#include "spriteBatch.hpp"
+#include <sstream>
+#include <stdexcept>
+
+using entity::SpriteBatch;
+
+SpriteBatch::SpriteBatch(const size_t slots) : vertices(sf::Quads, slots * 4), textures(slots, nullptr), usedSlots(0), texture(nullptr) {}
+
+void SpriteBatch::set(const size_t slot, const TextureRegion &region, const sf::Vector2f position, const sf::Vector2f scale) {
+    if (slot >= textures.size()) {
+        std::ostringstream errMsg;
+        errMsg << "SpriteBatch Error: must provide a slot between 0 and " << textures.size() << "; " << slot << " is invalid";
+        throw std::invalid_argument(errMsg.str());
+    }
+
+    // Drawn in one call whenever every non-empty slot uses the same texture
+    if (textures[slot] != region.texture.get()) {
+        releaseTexture(textures[slot]);
+        textures[slot] = region.texture.get();
+        useTexture(textures[slot]);
+    }
+
+    const auto left = (float) region.rect.left, top = (float) region.rect.top;
+    const auto right = left + (float) region.rect.width, bottom = top + (float) region.rect.height;
+    const sf::Vector2f size((float) region.rect.width * scale.x, (float) region.rect.height * scale.y);
+
+    sf::Vertex *quad = &vertices[slot * 4];
+    quad[0] = sf::Vertex(position, sf::Vector2f(left, top));
+    quad[1] = sf::Vertex(position + sf::Vector2f(size.x, 0), sf::Vector2f(right, top));
+    quad[2] = sf::Vertex(position + size, sf::Vector2f(right, bottom));
+    quad[3] = sf::Vertex(position + sf::Vector2f(0, size.y), sf::Vector2f(left, bottom));
+}
+
+void SpriteBatch::clear(const size_t slot) {
+    if (slot >= textures.size()) return;
+
+    releaseTexture(textures[slot]);
+    textures[slot] = nullptr;
+    for (size_t vertex = slot * 4; vertex < slot * 4 + 4; ++vertex) {
+        vertices[vertex] = sf::Vertex();
+    }
+}
+
+void SpriteBatch::clear() {
+    for (size_t slot = 0; slot < textures.size(); ++slot) {
+        clear(slot);
+    }
+}
+
+size_t SpriteBatch::size() const {
+    return textures.size();
+}
+
+void SpriteBatch::render(sf::RenderTarget &target) const {
+    if (usedSlots == 0) return;
+    if (texture != nullptr) {
+        target.draw(vertices, sf::RenderStates(texture));
+        return;
+    }
+
+    // The slots use different textures (e.g. no atlas could be created): draw them one at a time
+    for (size_t slot = 0; slot < textures.size(); ++slot) {
+        if (textures[slot] != nullptr) {
+            target.draw(&vertices[slot * 4], 4, sf::Quads, sf::RenderStates(textures[slot]));
+        }
+    }
+}
+
+void SpriteBatch::useTexture(const sf::Texture *used) {
+    if (used == nullptr) return;
+
+    ++usedSlots;
+    ++textureSlots[used];
+    texture = textureSlots.size() == 1 ? used : nullptr;
+}
+
+void SpriteBatch::releaseTexture(const sf::Texture *released) {
+    if (released == nullptr) return;
+
+    --usedSlots;
+    const auto slots = textureSlots.find(released);
+    if (--slots->second == 0) textureSlots.erase(slots);
+
+    // Back to one draw call once the last slot with another texture has changed
+    texture = textureSlots.size() == 1 ? textureSlots.begin()->first : nullptr;
+}
@@ -0,0 +1,78 @@
+/**
+ * Front-end class that draws many sprites of the same texture (e.g. a screen's atlas) in a single draw call
+ *
+ * The batch has a fixed number of slots, each holding one (unrotated) sprite or nothing. Changing a slot only
+ * rewrites its four vertices, so a layer such as the 100 targets of a grid is only updated when a square changes
+ */
+
+#ifndef BATTLESHIP_SPRITEBATCH_H
+#define BATTLESHIP_SPRITEBATCH_H
+
+#include "textureRegion.hpp"
+#include <SFML/Graphics.hpp>
+#include <map>
+#include <vector>
+
+namespace entity {
+
+    class SpriteBatch {
+    public:
+        /**
+         * Constructs a batch with the given number of (empty) slots
+         */
+        explicit SpriteBatch(size_t slots = 0);
+
+        /**
+         * Shows a texture region in a slot
+         *
+         * @param slot index of the slot (between 0 and the number of slots)
+         * @param region the texture region to draw
+         * @param position the position of the top left corner on the screen
+         * @param scale a vector to scale the region by (e.g (5, 5) for the game's pixel art)
+         */
+        void set(size_t slot, const TextureRegion &region, sf::Vector2f position, sf::Vector2f scale);
+
+        /**
+         * Empties a slot
+         */
+        void clear(size_t slot);
+
+        /**
+         * Empties every slot
+         */
+        void clear();
+
+        /**
+         * Returns the number of slots
+         */
+        [[nodiscard]] size_t size() const;
+
+        /**
+         * Draws every non-empty slot (in slot order)
+         */
+        void render(sf::RenderTarget &target) const;
+
+    private:
+        // Four vertices (a quad) per slot, empty slots are collapsed to a point so they draw nothing
+        sf::VertexArray vertices;
+
+        // Texture of each slot (nullptr if the slot is empty)
+        std::vector<const sf::Texture *> textures;
+
+        // Number of non-empty slots using each texture (usually one: the screen's atlas)
+        std::map<const sf::Texture *, size_t> textureSlots;
+
+        // Number of non-empty slots
+        size_t usedSlots;
+
+        // Texture used by every non-empty slot, or nullptr if they use different textures (drawn one slot at a time)
+        const sf::Texture *texture;
+
+        // Counts a slot that starts or stops using a texture, and updates the texture drawn in one call
+        void useTexture(const sf::Texture *used);
+        void releaseTexture(const sf::Texture *released);
+    };
+
+}// namespace entity
+
+#endif// BATTLESHIP_SPRITEBATCH_H
@@ -3,25 +3,21 @@
  */
 
 #include "target.hpp"
-#include "../helpers/helperFunctions.hpp"
 
 using entity::Target;
 
-std::unique_ptr<sf::Texture> Target::idleTexture = std::unique_ptr<sf::Texture>();
-std::unique_ptr<sf::Texture> Target::activeTexture = std::unique_ptr<sf::Texture>();
+entity::TextureRegion Target::idleTexture;
+entity::TextureRegion Target::activeTexture;
 
-void entity::Target::initializeTextures(const string &idlePath, const string &activePath) {
-    Target::idleTexture = std::make_unique<sf::Texture>();
-    Target::activeTexture = std::make_unique<sf::Texture>();
-
-    loadTexture(*Target::idleTexture, "gameplay/" + idlePath);
-    loadTexture(*Target::activeTexture, "gameplay/" + activePath);
+void entity::Target::initializeTextures(const TextureRegion &idle, const TextureRegion &active) {
+    Target::idleTexture = idle;
+    Target::activeTexture = active;
 }
 
 Target::Target(Coordinate coordinate, sf::Vector2f position, sf::Vector2f scale) {
     this->isActive = false;
     this->targetCoordinate = coordinate;
-    this->sprite.setTexture(*idleTexture);
+    idleTexture.applyTo(this->sprite);
     this->sprite.setPosition(position);
     this->sprite.setScale(scale);
 }
@@ -38,12 +34,26 @@ Coordinate Target::getTargetCoordinate() const {
     return this->targetCoordinate;
 }
 
-void Target::updateTargetState(const sf::Vector2f mousePosition) {
-    if (this->sprite.getGlobalBounds().contains(mousePosition)) {
-        this->isActive = true;
-        this->sprite.setTexture(*activeTexture);
-    } else {
-        this->isActive = false;
-        this->sprite.setTexture(*idleTexture);
-    }
+const entity::TextureRegion &Target::getTexture() const {
+    return this->isActive ? activeTexture : idleTexture;
+}
+
+sf::Vector2f Target::getPosition() const {
+    return this->sprite.getPosition();
+}
+
+sf::Vector2f Target::getScale() const {
+    return this->sprite.getScale();
+}
+
+bool Target::setTargetState(const bool active) {
+    if (this->isActive == active) return false;
+
+    this->isActive = active;
+    getTexture().applyTo(this->sprite);
+    return true;
+}
+
+bool Target::updateTargetState(const sf::Vector2f mousePosition) {
+    return this->setTargetState(this->sprite.getGlobalBounds().contains(mousePosition));
 }
@@ -6,6 +6,7 @@
 #define BATTLESHIP_TARGET_H
 
 #include "../entity/coordinate.hpp"
+#include "textureRegion.hpp"
 #include <SFML/Graphics.hpp>
 
 using entity::Coordinate;
@@ -21,9 +22,9 @@ namespace entity {
         Target(Coordinate coordinate, sf::Vector2f position, sf::Vector2f scale);
 
         /**
-         * Loads the static textures for the target
+         * Sets the static textures for the target
          */
-        static void initializeTextures(const string& idlePath, const string& activePath);
+        static void initializeTextures(const TextureRegion &idle, const TextureRegion &active);
 
         /**
          * Returns true if the target is active (i.e. the cursor is over the targetCoordinate)
@@ -35,22 +36,42 @@ namespace entity {
          */
         Coordinate getTargetCoordinate() const;
 
+        /**
+         * Returns the texture region the target currently shows (idle or active)
+         */
+        const TextureRegion &getTexture() const;
+
+        /**
+         * Returns the position of the target on the screen
+         */
+        sf::Vector2f getPosition() const;
+
+        /**
+         * Returns the scale of the target
+         */
+        sf::Vector2f getScale() const;
+
         /**
          * Renders the target sprite on the window
          */
         void render(sf::RenderWindow &window) const;
 
         /**
-         * Updates the target state
+         * Sets the target state, returns true if it changed (i.e. the target needs to be redrawn)
+         */
+        bool setTargetState(bool active);
+
+        /**
+         * Updates the target state, returns true if it changed (i.e. the target needs to be redrawn)
          */
-        void updateTargetState(sf::Vector2f mousePosition);
+        bool updateTargetState(sf::Vector2f mousePosition);
 
     private:
         // Idle target texture (same for all targets)
-        static std::unique_ptr<sf::Texture> idleTexture;
+        static TextureRegion idleTexture;
 
         // Active target texture (same for all targets)
-        static std::unique_ptr<sf::Texture> activeTexture;
+        static TextureRegion activeTexture;
 
         // Target's current sprite (idle or active)
         sf::Sprite sprite;
@@ -0,0 +1,33 @@
+/**
+ * A rectangle of a (possibly shared) texture, e.g. one image packed into a texture atlas
+ */
+
+#ifndef BATTLESHIP_TEXTUREREGION_H
+#define BATTLESHIP_TEXTUREREGION_H
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+
+namespace entity {
+
+    struct TextureRegion {
+        // Texture the region is part of
+        std::shared_ptr<const sf::Texture> texture;
+
+        // Area of the texture covered by the region
+        sf::IntRect rect;
+
+        /**
+         * Makes a sprite show this region
+         */
+        void applyTo(sf::Sprite &sprite) const {
+            if (sprite.getTexture() != texture.get()) {
+                sprite.setTexture(*texture);
+            }
+            sprite.setTextureRect(rect);
+        }
+    };
+
+}// namespace entity
+
+#endif//BATTLESHIP_TEXTUREREGION_H
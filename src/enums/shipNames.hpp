@@ -16,6 +16,11 @@ namespace entity {
         Battleship
     };
 
+    /**
+     * Number of ships in every fleet (one of each name)
+     */
+    constexpr int shipCount = 6;
+
 }// namespace entity
 
 #endif//BATTLESHIP_SHIPNAMES_H
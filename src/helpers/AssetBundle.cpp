@@ -0,0 +1,188 @@
+/**
+ * AssetBundle class implementation
+ */
+
+#include "AssetBundle.hpp"
+#include "helperFunctions.hpp"
+#include <algorithm>
+#include <map>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    // A read-only memory mapping of a whole file
+    class MappedFile {
+    public:
+        explicit MappedFile(const string &path) {
+#ifdef _WIN32
+            file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) return;
+            LARGE_INTEGER fileSize;
+            if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) return;
+            mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping == nullptr) return;
+            const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (view == nullptr) return;
+            bytes = static_cast<const uint8_t *>(view);
+            size = (size_t) fileSize.QuadPart;
+#else
+            const int descriptor = open(path.c_str(), O_RDONLY);
+            if (descriptor == -1) return;
+            struct stat status {};
+            if (fstat(descriptor, &status) == 0 && status.st_size > 0) {
+                void *view = mmap(nullptr, (size_t) status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+                if (view != MAP_FAILED) {
+                    bytes = static_cast<const uint8_t *>(view);
+                    size = (size_t) status.st_size;
+                }
+            }
+            close(descriptor);// The mapping stays valid after the file is closed
+#endif
+        }
+
+        ~MappedFile() {
+#ifdef _WIN32
+            if (bytes != nullptr) UnmapViewOfFile(bytes);
+            if (mapping != nullptr) CloseHandle(mapping);
+            if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+#else
+            if (bytes != nullptr) munmap(const_cast<uint8_t *>(bytes), size);
+#endif
+        }
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        // Start of the file in memory (nullptr if the file couldn't be mapped)
+        const uint8_t *bytes = nullptr;
+
+        // Size of the file in bytes
+        size_t size = 0;
+
+    private:
+#ifdef _WIN32
+        HANDLE file = INVALID_HANDLE_VALUE;
+        HANDLE mapping = nullptr;
+#endif
+    };
+
+    // Reads a little-endian unsigned integer of N bytes
+    template<typename T, size_t N = sizeof(T)>
+    T readLittleEndian(const uint8_t *bytes) {
+        T value = 0;
+        for (size_t i = 0; i < N; ++i) {
+            value |= (T) bytes[i] << (8 * i);
+        }
+        return value;
+    }
+
+    // An entry of the bundle's index
+    struct Entry {
+        uint32_t type, width, height;
+        const uint8_t *payload;
+        uint64_t size;
+    };
+
+    // The opened bundle
+    struct Bundle {
+        std::unique_ptr<MappedFile> file;
+        std::map<string, Entry, std::less<>> entries;
+        std::map<string, std::weak_ptr<const sf::Texture>> textures;
+
+        // Maps and indexes the bundle, leaves it empty if it is missing or invalid
+        explicit Bundle(const string &path) : file(std::make_unique<MappedFile>(path)) {
+            if (!index()) entries.clear();
+        }
+
+        bool index() {
+            const uint8_t *bytes = file->bytes;
+            const size_t size = file->size;
+            if (bytes == nullptr || size < AssetBundle::headerSize) return false;
+            if (!std::equal(bytes, bytes + 4, AssetBundle::magic)) return false;
+            if (readLittleEndian<uint32_t>(bytes + 4) != AssetBundle::version) return false;
+
+            const uint32_t count = readLittleEndian<uint32_t>(bytes + 8);
+            const uint32_t indexSize = readLittleEndian<uint32_t>(bytes + 12);
+            if (indexSize > size - AssetBundle::headerSize) return false;
+
+            size_t position = AssetBundle::headerSize;
+            const size_t end = AssetBundle::headerSize + (size_t) indexSize;
+            for (uint32_t i = 0; i < count; ++i) {
+                if (end - position < AssetBundle::entryHeaderSize) return false;
+                Entry entry{};
+                entry.type = readLittleEndian<uint32_t>(bytes + position);
+                entry.width = readLittleEndian<uint32_t>(bytes + position + 4);
+                entry.height = readLittleEndian<uint32_t>(bytes + position + 8);
+                const uint64_t offset = readLittleEndian<uint64_t>(bytes + position + 12);
+                entry.size = readLittleEndian<uint64_t>(bytes + position + 20);
+                const uint16_t nameLength = readLittleEndian<uint16_t>(bytes + position + 28);
+                position += AssetBundle::entryHeaderSize;
+
+                if (end - position < nameLength) return false;
+                string name(reinterpret_cast<const char *>(bytes + position), nameLength);
+                position += nameLength;
+
+                // The payload has to be inside the file (and an image has to have all its pixels)
+                if (offset > size || entry.size > size - offset) return false;
+                if (entry.type == AssetBundle::ImageEntry && entry.size != (uint64_t) entry.width * entry.height * 4) return false;
+                entry.payload = bytes + offset;
+
+                entries.emplace(std::move(name), entry);
+            }
+            return true;
+        }
+    };
+
+    Bundle &bundle() {
+        static Bundle instance = []() {
+            // Prefer the bundle next to the executable, then the one in res/
+            const string executable = executableDirectory();
+            if (!executable.empty()) {
+                Bundle besideExecutable(executable + AssetBundle::fileName);
+                if (!besideExecutable.entries.empty()) return besideExecutable;
+            }
+            return Bundle(resourcesPath + AssetBundle::fileName);
+        }();
+        return instance;
+    }
+}// namespace
+
+bool AssetBundle::available() {
+    return !bundle().entries.empty();
+}
+
+bool AssetBundle::contains(const string &name) {
+    return bundle().entries.count(name) != 0;
+}
+
+shared_ptr<const sf::Texture> AssetBundle::texture(const string &name) {
+    Bundle &opened = bundle();
+    const auto entry = opened.entries.find(name);
+    if (entry == opened.entries.end() || entry->second.type != ImageEntry) return nullptr;
+
+    if (shared_ptr<const sf::Texture> cached = opened.textures[name].lock()) {
+        return cached;
+    }
+
+    // Upload the pixels straight from the mapped file
+    auto texture = std::make_shared<sf::Texture>();
+    if (!texture->create(entry->second.width, entry->second.height)) return nullptr;
+    texture->update(entry->second.payload);
+
+    opened.textures[name] = texture;
+    return texture;
+}
+
+std::string_view AssetBundle::data(const string &name) {
+    Bundle &opened = bundle();
+    const auto entry = opened.entries.find(name);
+    if (entry == opened.entries.end()) return {};
+    return {reinterpret_cast<const char *>(entry->second.payload), (size_t) entry->second.size};
+}
@@ -0,0 +1,67 @@
+/**
+ * Read-only access to the asset bundle: a single file holding the game's images already decoded, which is mapped
+ * into memory so textures are created straight from it without opening, reading or decoding any image files
+ *
+ * The bundle is built by the battleship-bundle tool. All numbers are little-endian:
+ *   Header:  "BSHB" (4 bytes), version (uint32), number of entries (uint32), size of the index (uint32)
+ *   Index:   for each entry: type (uint32: 0 = raw bytes, 1 = RGBA image), width (uint32), height (uint32),
+ *            offset of the payload from the start of the file (uint64), payload size (uint64),
+ *            name length (uint16), name (e.g. "atlas/gameplay.png", relative to res/)
+ *   Payload: raw bytes, or width * height RGBA pixels (4 bytes each, row by row)
+ */
+
+#ifndef BATTLESHIP_ASSETBUNDLE_H
+#define BATTLESHIP_ASSETBUNDLE_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+using std::shared_ptr;
+using std::string;
+
+class AssetBundle {
+public:
+    // Types of payload in the bundle
+    enum EntryType : uint32_t {
+        RawEntry = 0,
+        ImageEntry = 1
+    };
+
+    // Identifies the bundle format
+    static constexpr char magic[4] = {'B', 'S', 'H', 'B'};
+    static constexpr uint32_t version = 2;
+
+    // Size of the header, and of an index entry without its name
+    static constexpr size_t headerSize = 16;
+    static constexpr size_t entryHeaderSize = 30;
+
+    // Name of the bundle file (next to the executable or in res/)
+    static constexpr const char *fileName = "battleship.bundle";
+
+    /**
+     * Returns true if the bundle was found and is valid (it is opened the first time it is used)
+     */
+    static bool available();
+
+    /**
+     * Returns true if the bundle has an entry
+     *
+     * @param name the name of the entry, relative to res/ (e.g. "atlas/gameplay.png")
+     */
+    static bool contains(const string &name);
+
+    /**
+     * Returns the texture of an image entry (shared while it is in use), or nullptr if there is no such image
+     */
+    static shared_ptr<const sf::Texture> texture(const string &name);
+
+    /**
+     * Returns the contents of a raw entry (an empty view if there is no such entry)
+     */
+    static std::string_view data(const string &name);
+};
+
+#endif//BATTLESHIP_ASSETBUNDLE_H
@@ -0,0 +1,158 @@
+/**
+ * AssetLoader class implementation
+ */
+
+#include "AssetLoader.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace {
+    // 64-bit FNV-1a hash of a block of bytes
+    uint64_t hashBytes(const vector<char> &bytes) {
+        uint64_t hash = 14695981039346656037ULL;
+        for (const char byte : bytes) {
+            hash = (hash ^ (uint8_t) byte) * 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    // Worker threads and the files they decode
+    class Workers {
+    public:
+        Workers() {
+            const unsigned count = std::max(1u, std::min(4u, std::thread::hardware_concurrency()));
+            for (unsigned i = 0; i < count; ++i) {
+                threads.emplace_back([this]() { work(); });
+            }
+        }
+
+        ~Workers() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (auto &thread : threads) {
+                thread.join();
+            }
+        }
+
+        // Queues a file to decode, unless it is already queued or decoded
+        void add(const string &filePath) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (results.count(filePath) != 0) return;
+
+                std::promise<AssetLoader::DecodedImage> promise;
+                results[filePath] = promise.get_future().share();
+                queue.emplace_back(filePath, std::move(promise));
+                ++preloaded;
+            }
+            wake.notify_one();
+        }
+
+        // Removes a file's result (an invalid future if it was never queued)
+        std::shared_future<AssetLoader::DecodedImage> remove(const string &filePath) {
+            std::lock_guard<std::mutex> lock(mutex);
+            const auto result = results.find(filePath);
+            if (result == results.end()) return {};
+
+            std::shared_future<AssetLoader::DecodedImage> future = result->second;
+            results.erase(result);
+            return future;
+        }
+
+        // Returns true if the file was decoded (or was never queued)
+        bool done(const string &filePath) {
+            std::lock_guard<std::mutex> lock(mutex);
+            const auto result = results.find(filePath);
+            return result == results.end() || result->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+
+        // Fraction of the queued files that have been decoded
+        float progress() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return preloaded == 0 ? 1.0f : (float) finished / (float) preloaded;
+        }
+
+    private:
+        std::vector<std::thread> threads;
+        std::mutex mutex;
+        std::condition_variable wake;
+        bool stopping = false;
+
+        // Files waiting to be decoded
+        std::deque<std::pair<string, std::promise<AssetLoader::DecodedImage>>> queue;
+
+        // Decoded (or pending) files that haven't been taken yet
+        std::map<string, std::shared_future<AssetLoader::DecodedImage>> results;
+
+        // Number of files queued and decoded so far
+        size_t preloaded = 0, finished = 0;
+
+        void work() {
+            while (true) {
+                std::pair<string, std::promise<AssetLoader::DecodedImage>> job;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wake.wait(lock, [this]() { return stopping || !queue.empty(); });
+                    if (stopping) return;
+
+                    job = std::move(queue.front());
+                    queue.pop_front();
+                }
+
+                job.second.set_value(AssetLoader::decode(job.first));
+
+                std::lock_guard<std::mutex> lock(mutex);
+                ++finished;
+            }
+        }
+    };
+
+    Workers &workers() {
+        static Workers instance;
+        return instance;
+    }
+}// namespace
+
+void AssetLoader::preload(const vector<string> &filePaths) {
+    for (const string &filePath : filePaths) {
+        workers().add(filePath);
+    }
+}
+
+AssetLoader::DecodedImage AssetLoader::take(const string &filePath) {
+    std::shared_future<DecodedImage> future = workers().remove(filePath);
+    return future.valid() ? future.get() : decode(filePath);
+}
+
+bool AssetLoader::decoded(const vector<string> &filePaths) {
+    return std::all_of(filePaths.begin(), filePaths.end(), [](const string &filePath) {
+        return workers().done(filePath);
+    });
+}
+
+float AssetLoader::progress() {
+    return workers().progress();
+}
+
+AssetLoader::DecodedImage AssetLoader::decode(const string &filePath) {
+    DecodedImage decoded;
+
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file) return decoded;
+    const vector<char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    decoded.hash = hashBytes(bytes);
+    decoded.fileSize = bytes.size();
+    decoded.loaded = !bytes.empty() && decoded.image.loadFromMemory(bytes.data(), bytes.size());
+    return decoded;
+}
@@ -0,0 +1,62 @@
+/**
+ * Decodes image files on worker threads so the window can keep responding while the game loads
+ *
+ * Only decoding happens on the workers (into an sf::Image, which doesn't need an OpenGL context). Textures are still
+ * created on the main thread from the decoded images (see TextureCache)
+ */
+
+#ifndef BATTLESHIP_ASSETLOADER_H
+#define BATTLESHIP_ASSETLOADER_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+class AssetLoader {
+public:
+    // A decoded image file
+    struct DecodedImage {
+        // False if the file can't be read or isn't a valid image
+        bool loaded = false;
+
+        // Hash (64-bit FNV-1a) and size of the file contents, used to find identical images
+        uint64_t hash = 0;
+        size_t fileSize = 0;
+
+        // The decoded pixels
+        sf::Image image;
+    };
+
+    /**
+     * Starts decoding image files on the worker threads (in the given order)
+     * Files that are already being decoded are skipped
+     */
+    static void preload(const vector<string> &filePaths);
+
+    /**
+     * Returns a decoded image file, waiting for it if it is being decoded or decoding it now if it was not preloaded
+     * The loader doesn't keep the image afterwards
+     */
+    static DecodedImage take(const string &filePath);
+
+    /**
+     * Returns true if every one of the files has been decoded (or was never preloaded)
+     */
+    static bool decoded(const vector<string> &filePaths);
+
+    /**
+     * Returns the fraction (between 0 and 1) of the preloaded files that have been decoded
+     */
+    static float progress();
+
+    /**
+     * Reads and decodes an image file on the calling thread
+     */
+    static DecodedImage decode(const string &filePath);
+};
+
+#endif//BATTLESHIP_ASSETLOADER_H
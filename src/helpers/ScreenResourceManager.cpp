@@ -4,6 +4,12 @@
  */
 
 #include "ScreenResourceManager.hpp"
+#include "AssetBundle.hpp"
+#include "AssetLoader.hpp"
+#include "TextureAtlas.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <set>
 #include <sstream>
 
 using std::get;
@@ -13,14 +19,7 @@ ScreenResourceManager::ScreenResourceManager(const string& screenName,
                                              const vector<tuple<sf::Vector2f, sf::Vector2f, int>> &spritesData,
                                              const vector<tuple<sf::Vector2f, sf::Vector2f, int, int>> &buttons) {
     // Initialize the textures
-    for (int i = 0; i < texturePaths.size(); ++i) {
-        this->textures.emplace_back(); // Add a new texture
-
-        // Attempt to load the texture image
-        sf::Texture &texture = this->textures[i];
-        string texturePath = screenName + "/" + texturePaths[i];
-        loadTexture(texture, texturePath);
-    }
+    this->textures = loadTextures(screenName, texturePaths);
 
     // Initialize the sprites
     for (int i = 0; i < spritesData.size(); ++i) {
@@ -30,12 +29,12 @@ ScreenResourceManager::ScreenResourceManager(const string& screenName,
         auto sprite = &this->sprites[i];
         auto const position = get<0>(spritesData[i]);
         auto const scale = get<1>(spritesData[i]);
-        auto const *texture = &textures[get<2>(spritesData[i])];
+        auto const &texture = textures[get<2>(spritesData[i])];
 
         // Initialize the sprite with its required data
         sprite->setPosition(position);
         sprite->setScale(scale);
-        sprite->setTexture(*texture);
+        texture.applyTo(*sprite);
     }
 
     // Initialize the buttons
@@ -43,11 +42,110 @@ ScreenResourceManager::ScreenResourceManager(const string& screenName,
         // Get the button data
         auto const position = get<0>(button);
         auto const scale = get<1>(button);
-        auto *idleTexture = &textures[get<2>(button)];
-        auto *activeTexture = &textures[get<3>(button)];
+        auto const &idleTexture = textures[get<2>(button)];
+        auto const &activeTexture = textures[get<3>(button)];
+
+        this->buttons.emplace_back(position, scale, idleTexture, activeTexture);
+    }
+}
+
+vector<TextureRegion> ScreenResourceManager::loadTextures(const string &screenName, const vector<string> &texturePaths) {
+    vector<TextureRegion> regions;
+    if (texturePaths.empty()) return regions;
+
+    // Returns the regions of the screen's textures in the atlases of a manifest (none if an atlas can't be loaded)
+    TextureAtlas::Manifest manifest;
+    const auto fromAtlases = [&texturePaths, &manifest](const auto &loadAtlas) {
+        vector<TextureRegion> found;
+        map<string, shared_ptr<const sf::Texture>> atlases;
+        for (const string &path : texturePaths) {
+            const auto region = manifest.find(path);
+            if (region == manifest.end()) return vector<TextureRegion>();
+
+            shared_ptr<const sf::Texture> &atlas = atlases[region->second.atlas];
+            if (atlas == nullptr) atlas = loadAtlas(region->second.atlas);
+            if (atlas == nullptr) return vector<TextureRegion>();
+            found.push_back({atlas, region->second.rect});
+        }
+        return found;
+    };
+
+    // Use the screen's atlases from the asset bundle if there are any
+    std::istringstream bundledManifest(string(AssetBundle::data("atlas/" + screenName + ".txt")));
+    if (TextureAtlas::readManifest(bundledManifest, manifest)) {
+        regions = fromAtlases([](const string &atlas) { return AssetBundle::texture("atlas/" + atlas + ".png"); });
+        if (!regions.empty()) return regions;
+    }
+
+    // Then the prebuilt atlases if they have every texture of this screen
+    manifest.clear();
+    if (TextureAtlas::readManifest(atlasesPath + screenName + ".txt", manifest)) {
+        regions = fromAtlases([](const string &atlas) { return TextureCache::load(atlasesPath + atlas + ".png"); });
+        if (!regions.empty()) return regions;
+    }
+
+    // Otherwise pack the screen's images now
+    vector<sf::Image> images(texturePaths.size());
+    for (std::size_t i = 0; i < texturePaths.size(); ++i) {
+        AssetLoader::DecodedImage decoded = AssetLoader::take(resourcesPath + "images/" + screenName + "/" + texturePaths[i]);
+        if (!decoded.loaded) {
+            std::cout << "Error: unable to open file: /res/images/" << screenName << "/" << texturePaths[i] << std::endl;
+            exit(-1);
+        }
+        images[i] = std::move(decoded.image);
+    }
+    sf::Image atlasImage;
+    const vector<sf::IntRect> rects = TextureAtlas::build(images, atlasImage);
+
+    auto atlas = std::make_shared<sf::Texture>();
+    const unsigned maximumSize = sf::Texture::getMaximumSize();
+    if (atlasImage.getSize().x <= maximumSize && atlasImage.getSize().y <= maximumSize && atlas->loadFromImage(atlasImage)) {
+        for (const auto &rect : rects) {
+            regions.push_back({atlas, rect});
+        }
+        return regions;
+    }
 
-        this->buttons.emplace_back(position, scale, *idleTexture, *activeTexture);
+    // The atlas is too large for this graphics card: use a texture per image
+    for (const string &path : texturePaths) {
+        auto texture = loadTexture(screenName + "/" + path);
+        regions.push_back({texture, sf::IntRect(0, 0, (int) texture->getSize().x, (int) texture->getSize().y)});
     }
+    return regions;
+}
+
+vector<string> ScreenResourceManager::assetFiles(const string &screenName) {
+    // Nothing to decode if the screen is in the asset bundle
+    if (AssetBundle::contains("atlas/" + screenName + ".txt")) return {};
+
+    // The prebuilt atlases if there are any
+    TextureAtlas::Manifest manifest;
+    if (TextureAtlas::readManifest(atlasesPath + screenName + ".txt", manifest)) {
+        std::set<string> files;
+        for (const auto &entry : manifest) {
+            files.insert(atlasesPath + entry.second.atlas + ".png");
+        }
+        return {files.begin(), files.end()};
+    }
+
+    // Otherwise every image of the screen
+    vector<string> files;
+    std::error_code error;
+    for (const auto &entry : std::filesystem::directory_iterator(resourcesPath + "images/" + screenName, error)) {
+        if (entry.path().extension() == ".png") {
+            files.push_back(resourcesPath + "images/" + screenName + "/" + entry.path().filename().string());
+        }
+    }
+    return files;
+}
+
+const TextureRegion &ScreenResourceManager::getTexture(const int index) const {
+    if (index > textures.size()) {
+        std::ostringstream errMsg;
+        errMsg << "Texture Error: must provide an index between 0 and " << textures.size() << "; " << index << " is invalid";
+        throw std::invalid_argument(errMsg.str());
+    }
+    return textures[index];
 }
 
 sf::Sprite &ScreenResourceManager::getSprite(const int index) {
@@ -67,3 +165,19 @@ Button &ScreenResourceManager::getButton(const int index) {
     }
     return buttons[index];
 }
+
+bool ScreenResourceManager::updateButtons(const sf::Vector2f mousePosition) {
+    // Keep the same button if the mouse is still over it (the usual case)
+    if (hoveredButton != -1 && buttons[hoveredButton].contains(mousePosition)) return false;
+
+    int hovered = -1;
+    for (std::size_t i = 0; i < buttons.size() && hovered == -1; ++i) {
+        if (buttons[i].contains(mousePosition)) hovered = (int) i;
+    }
+    if (hovered == hoveredButton) return false;
+
+    if (hoveredButton != -1) buttons[hoveredButton].setButtonState(false);
+    if (hovered != -1) buttons[hovered].setButtonState(true);
+    hoveredButton = hovered;
+    return true;
+}
@@ -7,6 +7,7 @@
 #define BATTLESHIP_RESOURCEMANAGER_H
 
 #include "../entity/button.hpp"
+#include "../entity/textureRegion.hpp"
 #include "helperFunctions.hpp"
 
 // Required data to initialize a sprite: std::tuple<sf::Vector2f, sf::Vector2f, int>
@@ -15,6 +16,7 @@ typedef std::tuple<sf::Vector2f, sf::Vector2f, int> sprite;
 typedef std::tuple<sf::Vector2f, sf::Vector2f, int, int> button;
 
 using entity::Button;
+using entity::TextureRegion;
 using std::tuple;
 using std::vector;
 
@@ -23,6 +25,10 @@ public:
     /**
      * Initializes this manager with textures and sprites
      *
+     * All the textures of a screen are regions of its atlas texture (and of the shared atlas for images used by other
+     * screens too): the prebuilt ones in the atlas directory if there are any (see the battleship-atlas tool),
+     * otherwise the screen's images are packed into an atlas when loading
+     *
      * @param screenName the name of the screen i.e folder in res/images/ where the textures are located
      *                   (do not include a leading or trailing forward slash)
      * @param texturePaths paths to textures to load relative to res/images/[<i>screenName</i>]
@@ -46,6 +52,18 @@ public:
      */
     ScreenResourceManager() = delete;
 
+    /**
+     * Returns the image files a screen loads its textures from (used to decode them ahead of time)
+     *
+     * @param screenName the name of the screen i.e folder in res/images/
+     */
+    static vector<string> assetFiles(const string &screenName);
+
+    /**
+     * Returns the texture region at the specified index
+     */
+    const TextureRegion &getTexture(int index) const;
+
     /**
      * Returns a reference to the sprite at the specified index
      */
@@ -56,15 +74,28 @@ public:
      */
     Button &getButton(int index);
 
+    /**
+     * Makes the button under the mouse (if any) active and every other button idle
+     * Only the previously and newly hovered buttons are updated
+     * Returns true if a button changed state (i.e. the screen needs to be redrawn)
+     */
+    bool updateButtons(sf::Vector2f mousePosition);
+
 private:
-    // All the SFML textures in this manager
-    vector<sf::Texture> textures;
+    // All the textures in this manager (regions of the screen's atlas)
+    vector<TextureRegion> textures;
 
     // All the SFML sprites in this manager
     vector<sf::Sprite> sprites;
 
     // All the SFML buttons in this manager
     vector<Button> buttons;
+
+    // Index of the button under the mouse (-1 if the mouse is not over a button)
+    int hoveredButton = -1;
+
+    // Loads the textures of a screen as regions of a single atlas texture
+    static vector<TextureRegion> loadTextures(const string &screenName, const vector<string> &texturePaths);
 };
 
 #endif//BATTLESHIP_RESOURCEMANAGER_H
@@ -0,0 +1,170 @@
+/**
+ * TextureAtlas class implementation
+ */
+
+#include "TextureAtlas.hpp"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <set>
+
+namespace fs = std::filesystem;
+
+vector<sf::IntRect> TextureAtlas::pack(const vector<sf::Vector2u> &sizes, sf::Vector2u &atlasSize) {
+    vector<sf::IntRect> rects(sizes.size());
+    atlasSize = sf::Vector2u(0, 0);
+    if (sizes.empty()) return rects;
+
+    // Place the tallest images first so each shelf wastes as little height as possible
+    vector<size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sizes](const size_t a, const size_t b) {
+        return sizes[a].y > sizes[b].y;
+    });
+
+    // Aim for a roughly square atlas, but always wide enough for the widest image
+    unsigned area = 0, widest = 0;
+    for (const auto &size : sizes) {
+        area += (size.x + padding) * (size.y + padding);
+        widest = std::max(widest, size.x + padding);
+    }
+    const unsigned shelfWidth = std::max(widest, (unsigned) std::ceil(std::sqrt((double) area)));
+
+    unsigned x = 0, y = 0, shelfHeight = 0;
+    for (const size_t i : order) {
+        if (x + sizes[i].x + padding > shelfWidth) {// Start a new shelf
+            x = 0;
+            y += shelfHeight;
+            shelfHeight = 0;
+        }
+        rects[i] = sf::IntRect((int) x, (int) y, (int) sizes[i].x, (int) sizes[i].y);
+
+        x += sizes[i].x + padding;
+        shelfHeight = std::max(shelfHeight, sizes[i].y + padding);
+        atlasSize.x = std::max(atlasSize.x, x);
+    }
+    atlasSize.y = y + shelfHeight;
+    return rects;
+}
+
+vector<sf::IntRect> TextureAtlas::build(const vector<sf::Image> &images, sf::Image &atlas) {
+    vector<sf::Vector2u> sizes;
+    sizes.reserve(images.size());
+    for (const auto &image : images) {
+        sizes.push_back(image.getSize());
+    }
+
+    sf::Vector2u atlasSize;
+    vector<sf::IntRect> rects = pack(sizes, atlasSize);
+
+    atlas.create(atlasSize.x, atlasSize.y, sf::Color::Transparent);
+    for (size_t i = 0; i < images.size(); ++i) {
+        atlas.copy(images[i], rects[i].left, rects[i].top);
+    }
+    return rects;
+}
+
+bool TextureAtlas::buildScreens(const string &imagesDirectory, vector<Atlas> &atlases, map<string, Manifest> &manifests) {
+    // Every image of every screen, in name order so the atlases are the same on every platform
+    std::error_code error;
+    map<string, map<string, sf::Image>> screens;
+    for (const auto &screen : fs::directory_iterator(imagesDirectory, error)) {
+        if (!screen.is_directory()) continue;
+
+        map<string, sf::Image> &images = screens[screen.path().filename().string()];
+        for (const auto &file : fs::directory_iterator(screen.path(), error)) {
+            if (!file.is_regular_file() || file.path().extension() != ".png") continue;
+            if (!images[file.path().filename().string()].loadFromFile(file.path().string())) return false;
+        }
+    }
+    if (error) return false;
+
+    // Images with the same size and pixels are the same image, wherever they are
+    typedef std::pair<std::pair<unsigned, unsigned>, std::basic_string<sf::Uint8>> ImageKey;
+    const auto key = [](const sf::Image &image) {
+        const sf::Uint8 *pixels = image.getPixelsPtr();
+        const size_t size = (size_t) image.getSize().x * image.getSize().y * 4;
+        return ImageKey({image.getSize().x, image.getSize().y}, pixels == nullptr ? std::basic_string<sf::Uint8>() : std::basic_string<sf::Uint8>(pixels, size));
+    };
+    map<ImageKey, std::set<string>> screensWithImage;
+    for (const auto &[screen, images] : screens) {
+        for (const auto &[name, image] : images) {
+            screensWithImage[key(image)].insert(screen);
+        }
+    }
+
+    // Sort the images into atlases (the shared images are added once, under the name of their first copy)
+    map<string, vector<std::pair<string, const sf::Image *>>> atlasImages;
+    map<ImageKey, string> sharedNames;
+    for (const auto &[screen, images] : screens) {
+        for (const auto &[name, image] : images) {
+            const ImageKey imageKey = key(image);
+            if (screensWithImage[imageKey].size() == 1) {
+                atlasImages[screen].emplace_back(name, &image);
+            } else if (sharedNames.emplace(imageKey, screen + "/" + name).second) {
+                atlasImages[sharedAtlas].emplace_back(screen + "/" + name, &image);
+            }
+        }
+    }
+
+    // Pack each atlas
+    map<string, map<string, sf::IntRect>> rects;
+    atlases.clear();
+    for (const auto &[atlas, images] : atlasImages) {
+        vector<sf::Image> copies;
+        for (const auto &image : images) {
+            copies.push_back(*image.second);
+        }
+        atlases.push_back({atlas, sf::Image()});
+        const vector<sf::IntRect> packed = build(copies, atlases.back().image);
+        for (size_t i = 0; i < images.size(); ++i) {
+            rects[atlas][images[i].first] = packed[i];
+        }
+    }
+
+    // Each screen's manifest has all its images, whichever atlas they are in
+    manifests.clear();
+    for (const auto &[screen, images] : screens) {
+        Manifest &manifest = manifests[screen];
+        for (const auto &[name, image] : images) {
+            const auto shared = sharedNames.find(key(image));
+            if (shared == sharedNames.end()) {
+                manifest[name] = {screen, rects[screen][name]};
+            } else {
+                manifest[name] = {sharedAtlas, rects[sharedAtlas][shared->second]};
+            }
+        }
+    }
+    return true;
+}
+
+bool TextureAtlas::readManifest(const string &path, Manifest &regions) {
+    std::ifstream manifest(path);
+    if (!manifest) return false;
+    return readManifest(manifest, regions);
+}
+
+bool TextureAtlas::readManifest(std::istream &manifest, Manifest &regions) {
+    string name;
+    Region region;
+    while (manifest >> name >> region.atlas >> region.rect.left >> region.rect.top >> region.rect.width >> region.rect.height) {
+        regions[name] = region;
+    }
+    return manifest.eof();
+}
+
+bool TextureAtlas::writeManifest(const string &path, const Manifest &regions) {
+    std::ofstream manifest(path);
+    writeManifest(manifest, regions);
+    return (bool) manifest;
+}
+
+void TextureAtlas::writeManifest(std::ostream &manifest, const Manifest &regions) {
+    for (const auto &[name, region] : regions) {
+        const sf::IntRect &rect = region.rect;
+        manifest << name << ' ' << region.atlas << ' ' << rect.left << ' ' << rect.top << ' ' << rect.width << ' '
+                 << rect.height << '\n';
+    }
+}
@@ -0,0 +1,96 @@
+/**
+ * Packs many small images into a single texture atlas so a screen can be drawn without switching textures
+ *
+ * Atlases are built ahead of time by the battleship-atlas tool, which writes atlas/<screen>.png and a manifest
+ * (atlas/<screen>.txt) with the atlas and rectangle of every image of the screen: one
+ * "<file name> <atlas> <x> <y> <width> <height>" line per image. Images found in more than one screen folder
+ * (e.g. the back button) are packed once, into the shared atlas (atlas/shared.png), which those screens use as well
+ */
+
+#ifndef BATTLESHIP_TEXTUREATLAS_H
+#define BATTLESHIP_TEXTUREATLAS_H
+
+#include <SFML/Graphics.hpp>
+#include <istream>
+#include <ostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using std::map;
+using std::string;
+using std::vector;
+
+class TextureAtlas {
+public:
+    // Transparent pixels left between packed images
+    static constexpr int padding = 1;
+
+    // Name of the atlas holding the images used by more than one screen
+    static constexpr const char *sharedAtlas = "shared";
+
+    // Where an image is: the name of its atlas and its area of the atlas
+    struct Region {
+        string atlas;
+        sf::IntRect rect;
+    };
+
+    // Regions of a screen's images, keyed by image file name
+    typedef map<string, Region> Manifest;
+
+    // A packed atlas image and its name (a screen's name or sharedAtlas)
+    struct Atlas {
+        string name;
+        sf::Image image;
+    };
+
+    /**
+     * Packs rectangles of the given sizes into as small an area as possible (shelf packing, tallest first)
+     * Returns the position of each rectangle, in the same order as the sizes
+     *
+     * @param sizes the width and height of every rectangle to pack
+     * @param atlasSize set to the size of the area needed to hold all the rectangles
+     */
+    static vector<sf::IntRect> pack(const vector<sf::Vector2u> &sizes, sf::Vector2u &atlasSize);
+
+    /**
+     * Copies the images into one atlas image
+     * Returns the area of the atlas where each image was placed, in the same order as the images
+     */
+    static vector<sf::IntRect> build(const vector<sf::Image> &images, sf::Image &atlas);
+
+    /**
+     * Packs the images of every screen (each folder of the images directory) into atlases: an image found with the
+     * same pixels in more than one screen goes into the shared atlas, the others into their screen's atlas
+     * Returns false if a folder or image can't be read
+     *
+     * @param atlases set to every atlas, in name order
+     * @param manifests set to the regions of every screen's images, keyed by screen name
+     */
+    static bool buildScreens(const string &imagesDirectory, vector<Atlas> &atlases, map<string, Manifest> &manifests);
+
+    /**
+     * Reads the image regions of a screen's manifest
+     * Returns false if the manifest can't be opened or is malformed
+     */
+    static bool readManifest(const string &path, Manifest &regions);
+
+    /**
+     * Reads the image regions of a screen's manifest from a stream
+     * Returns false if the manifest is malformed
+     */
+    static bool readManifest(std::istream &manifest, Manifest &regions);
+
+    /**
+     * Writes the image regions of a screen's manifest
+     * Returns false if the manifest can't be written
+     */
+    static bool writeManifest(const string &path, const Manifest &regions);
+
+    /**
+     * Writes the image regions of a screen's manifest to a stream
+     */
+    static void writeManifest(std::ostream &manifest, const Manifest &regions);
+};
+
+#endif//BATTLESHIP_TEXTUREATLAS_H
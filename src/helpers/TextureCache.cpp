@@ -0,0 +1,39 @@
+/**
+ * TextureCache class implementation
+ */
+
+#include "TextureCache.hpp"
+#include "AssetLoader.hpp"
+
+std::map<TextureCache::ContentKey, std::weak_ptr<const sf::Texture>> TextureCache::textures;
+
+shared_ptr<const sf::Texture> TextureCache::load(const string &filePath) {
+    // Decoded on a worker thread if it was preloaded
+    const AssetLoader::DecodedImage decoded = AssetLoader::take(filePath);
+    if (!decoded.loaded) return nullptr;
+
+    // Reuse the texture if an image with the same contents is still loaded
+    const ContentKey key(decoded.hash, decoded.fileSize);
+    if (shared_ptr<const sf::Texture> cached = textures[key].lock()) {
+        return cached;
+    }
+
+    auto texture = std::make_shared<sf::Texture>();
+    if (!texture->loadFromImage(decoded.image)) return nullptr;
+
+    textures[key] = texture;
+    return texture;
+}
+
+size_t TextureCache::size() {
+    size_t loaded = 0;
+    for (auto entry = textures.begin(); entry != textures.end();) {
+        if (entry->second.expired()) {
+            entry = textures.erase(entry);// Forget textures nothing uses anymore
+        } else {
+            ++loaded;
+            ++entry;
+        }
+    }
+    return loaded;
+}
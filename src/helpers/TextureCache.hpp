@@ -0,0 +1,45 @@
+/**
+ * Process-wide cache of SFML textures shared by every screen
+ *
+ * Textures are keyed by the contents of their image file, so identical images stored in different
+ * screen folders (e.g. the instructions button) are only uploaded to the GPU once.
+ * A texture stays loaded for as long as something holds a reference to it
+ */
+
+#ifndef BATTLESHIP_TEXTURECACHE_H
+#define BATTLESHIP_TEXTURECACHE_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+using std::shared_ptr;
+using std::string;
+
+class TextureCache {
+public:
+    /**
+     * Returns the texture for an image file, loading it if no loaded texture has the same contents
+     * Returns nullptr if the file can't be read or isn't a valid image
+     *
+     * @param filePath path to the image file
+     */
+    static shared_ptr<const sf::Texture> load(const string &filePath);
+
+    /**
+     * Returns the number of textures currently loaded
+     */
+    static size_t size();
+
+private:
+    // Identifies an image by its contents: (hash of the file, file size in bytes)
+    typedef std::pair<uint64_t, size_t> ContentKey;
+
+    // Every loaded texture (entries expire once the last reference to the texture is released)
+    static std::map<ContentKey, std::weak_ptr<const sf::Texture>> textures;
+};
+
+#endif//BATTLESHIP_TEXTURECACHE_H
@@ -0,0 +1,47 @@
+/**
+ * Free helper functions for the game rules that do not depend on SFML
+ * (safe to use from the headless engine)
+ */
+
+#ifndef BATTLESHIP_GAMEHELPERS_H
+#define BATTLESHIP_GAMEHELPERS_H
+
+#include "../enums/shipNames.hpp"
+#include <random>
+#include <type_traits>
+
+using entity::shipNames;
+
+/**
+ * Returns the size of a ship from its enum value
+ */
+constexpr int shipSize(const shipNames name) noexcept {
+    return (int) static_cast<std::underlying_type_t<shipNames>>(name) + 1;
+}
+
+/**
+ * Returns the random number generator used by randomInt
+ * Each thread has its own generator, seeded from hardware until seedRandom is called
+ */
+inline std::mt19937 &randomEngine() {
+    thread_local std::mt19937 eng(std::random_device{}());
+    return eng;
+}
+
+/**
+ * Seeds the calling thread's random number generator (use a different seed on each thread)
+ */
+inline void seedRandom(const std::seed_seq::result_type seed, const std::seed_seq::result_type stream = 0) {
+    std::seed_seq sequence{seed, stream};
+    randomEngine().seed(sequence);
+}
+
+/**
+ * Returns a random integer in the range [start, end] (both inclusive)
+ */
+inline int randomInt(const int start, const int end) {
+    std::uniform_int_distribution<> dist(start, end);
+    return dist(randomEngine());
+}
+
+#endif//BATTLESHIP_GAMEHELPERS_H
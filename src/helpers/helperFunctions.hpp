@@ -7,40 +7,31 @@
 #define BATTLESHIP_HELPERS_H
 
 #include "../controllers/state.hpp"
-#include "../enums/shipNames.hpp"
-#include <random>
+#include "TextureCache.hpp"
+#include "gameHelpers.hpp"
+#include "paths.hpp"
 
-using entity::shipNames;
 using std::string;
 
-/**
- * Returns the size of a ship from its enum value
- */
-constexpr int shipSize(const shipNames name) noexcept {
-    return (int) static_cast<std::underlying_type_t<shipNames>>(name) + 1;
-}
+// Location of the game's resources (res/)
+inline const string resourcesPath = resourcesDirectory();
 
-/**
- * Returns a random integer in the range [start, end] (both inclusive)
- */
-inline int randomInt(const int start, const int end) {
-    static std::random_device rd; // Obtain a random number from hardware
-    static std::mt19937 eng(rd());// Seed the generator
-    std::uniform_int_distribution<> dist(start, end);
-    return dist(eng);
-}
+// Location of the prebuilt texture atlases (atlas/ next to the executable, or res/atlas/)
+inline const string atlasesPath = atlasDirectory();
 
 /**
- * Loads a texture from the given path
+ * Returns the texture for the given path, loading it through the shared texture cache
  *
  * Note: The texture path has to be relative to res/images
  * For example, "homepage/ActivePlayButton.png"
  */
-inline void loadTexture(sf::Texture &texture, const string &path) {
-    if (!texture.loadFromFile("../res/images/" + path)) {
+inline shared_ptr<const sf::Texture> loadTexture(const string &path) {
+    shared_ptr<const sf::Texture> texture = TextureCache::load(resourcesPath + "images/" + path);
+    if (texture == nullptr) {
         std::cout << "Error: unable to open file: /res/images/" << path << std::endl;
         exit(-1);
     }
+    return texture;
 }
 
 #endif//BATTLESHIP_HELPERS_H
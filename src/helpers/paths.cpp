@@ -0,0 +1,59 @@
+/**
+ * Path helpers implementation
+ */
+
+#include "paths.hpp"
+#include <filesystem>
+#include <vector>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#elif defined(__APPLE__)
+#include <mach-o/dyld.h>
+#endif
+
+namespace fs = std::filesystem;
+
+std::string executableDirectory() {
+    std::error_code error;
+    fs::path executable;
+
+#if defined(_WIN32)
+    std::vector<wchar_t> buffer(MAX_PATH);
+    DWORD length;
+    while ((length = GetModuleFileNameW(nullptr, buffer.data(), (DWORD) buffer.size())) == buffer.size()) {
+        buffer.resize(buffer.size() * 2);
+    }
+    if (length == 0) return "";
+    executable = fs::path(std::wstring(buffer.data(), length));
+#elif defined(__APPLE__)
+    uint32_t size = 0;
+    _NSGetExecutablePath(nullptr, &size);
+    std::vector<char> buffer(size);
+    if (_NSGetExecutablePath(buffer.data(), &size) != 0) return "";
+    executable = fs::canonical(buffer.data(), error);
+#else
+    executable = fs::read_symlink("/proc/self/exe", error);
+#endif
+
+    if (error || executable.empty()) return "";
+    return executable.parent_path().string() + "/";
+}
+
+std::string resourcesDirectory() {
+    const std::string executable = executableDirectory();
+    if (!executable.empty()) {
+        std::error_code error;
+        for (const std::string &candidate : {executable + "res/", executable + "../res/"}) {
+            if (fs::is_directory(candidate, error)) return candidate;
+        }
+    }
+    return "../res/";
+}
+
+std::string atlasDirectory() {
+    const std::string executable = executableDirectory();
+    std::error_code error;
+    if (!executable.empty() && fs::is_directory(executable + "atlas/", error)) return executable + "atlas/";
+    return resourcesDirectory() + "atlas/";
+}
@@ -0,0 +1,29 @@
+/**
+ * Locates the game's files independently of the working directory the game was launched from
+ */
+
+#ifndef BATTLESHIP_PATHS_H
+#define BATTLESHIP_PATHS_H
+
+#include <string>
+
+/**
+ * Returns the directory containing the running executable (with a trailing slash)
+ * Returns an empty string if it can't be determined
+ */
+std::string executableDirectory();
+
+/**
+ * Returns the path of the res/ directory (with a trailing slash)
+ * Looks next to the executable and in its parent directory before falling back to ../res/ (relative to the working
+ * directory)
+ */
+std::string resourcesDirectory();
+
+/**
+ * Returns the path of the directory of the prebuilt texture atlases (with a trailing slash)
+ * Looks for atlas/ next to the executable (where the build writes them) before falling back to res/atlas/
+ */
+std::string atlasDirectory();
+
+#endif//BATTLESHIP_PATHS_H
@@ -15,8 +15,12 @@ DifficultySelection::DifficultySelection() : ScreenTemplate() {
 
             "IdleEasyButton.png", // Buttons
             "ActiveEasyButton.png",
+            "IdleMediumButton.png",
+            "ActiveMediumButton.png",
             "IdleHardButton.png",
             "ActiveHardButton.png",
+            "IdleExpertButton.png",
+            "ActiveExpertButton.png",
             "IdleBackButton.png",
             "ActiveBackButton.png",
             "IdleInstructionsButton.png",
@@ -26,8 +30,10 @@ DifficultySelection::DifficultySelection() : ScreenTemplate() {
             {sf::Vector2f(0, 0), sf::Vector2f(5, 5), BackgroundTexture},
     };
     const vector<button> buttons = {
-            {sf::Vector2f(88 * 5, 92 * 5), sf::Vector2f(5, 5), IdleEasyButtonTexture, ActiveEasyButtonTexture},
-            {sf::Vector2f(200 * 5, 92 * 5), sf::Vector2f(5, 5), IdleHardButtonTexture, ActiveHardButtonTexture},
+            {sf::Vector2f(14 * 5, 92 * 5), sf::Vector2f(5, 5), IdleEasyButtonTexture, ActiveEasyButtonTexture},
+            {sf::Vector2f(106 * 5, 92 * 5), sf::Vector2f(5, 5), IdleMediumButtonTexture, ActiveMediumButtonTexture},
+            {sf::Vector2f(198 * 5, 92 * 5), sf::Vector2f(5, 5), IdleHardButtonTexture, ActiveHardButtonTexture},
+            {sf::Vector2f(290 * 5, 92 * 5), sf::Vector2f(5, 5), IdleExpertButtonTexture, ActiveExpertButtonTexture},
             {sf::Vector2f(320 * 5, 12 * 5), sf::Vector2f(5, 5), IdleBackButtonTexture, ActiveBackButtonTexture},
             {sf::Vector2f(352 * 5, 12 * 5), sf::Vector2f(5, 5), IdleInstructionsButtonTexture, ActiveInstructionsButtonTexture},
     };
@@ -45,43 +51,44 @@ class DifficultySelection &screen::DifficultySelection::getInstance() {
 
 void DifficultySelection::update() {
     const sf::Vector2f mousePosition = State::getMousePosition();
-
-    // Update every button's state
-    for (int i = EasyButton; i <= InstructionsButton; ++i) {
-        resources.getButton(i).updateButtonState(mousePosition);
-    }
+    if (resources.updateButtons(mousePosition)) invalidate();
 }
 
-void DifficultySelection::poll() {
-    sf::RenderWindow &gui = *State::gui;
-    sf::Event &event = State::event;
-
-    while (gui.pollEvent(event)) {
-        switch (event.type) {
-            case sf::Event::Closed:
-                gui.close();
-                break;
-            case sf::Event::MouseButtonReleased:
-                if (event.mouseButton.button == sf::Mouse::Left) {
-                    if (resources.getButton(EasyButton).getButtonState()) {
-                        State::difficulty = State::Difficulty::EASY;
-                        State::changeScreen(Screens::FleetPlacement);
-                    } else if (resources.getButton(HardButton).getButtonState()) {
-                        State::difficulty = State::Difficulty::HARD;
-                        State::changeScreen(Screens::FleetPlacement);
-                    } else if (resources.getButton(BackButton).getButtonState()) {
-                        State::changeScreen(Screens::GameModeSelection);
-                    } else if (resources.getButton(InstructionsButton).getButtonState()) {
-                        State::changeScreen(Screens::Instructions);
-                    }
-                    break;
+void DifficultySelection::handleEvent(const sf::Event &event) {
+    switch (event.type) {
+        case sf::Event::MouseButtonReleased:
+            if (event.mouseButton.button == sf::Mouse::Left) {
+                if (resources.getButton(EasyButton).getButtonState()) {
+                    selectDifficulty(State::Difficulty::EASY);
+                } else if (resources.getButton(MediumButton).getButtonState()) {
+                    selectDifficulty(State::Difficulty::MEDIUM);
+                } else if (resources.getButton(HardButton).getButtonState()) {
+                    selectDifficulty(State::Difficulty::HARD);
+                } else if (resources.getButton(ExpertButton).getButtonState()) {
+                    selectDifficulty(State::Difficulty::EXPERT);
+                } else if (resources.getButton(BackButton).getButtonState()) {
+                    State::changeScreen(Screens::GameModeSelection);
+                } else if (resources.getButton(InstructionsButton).getButtonState()) {
+                    State::changeScreen(Screens::Instructions);
                 }
-            default:
-                break;
-        }
+            }
+            break;
+        case sf::Event::KeyReleased:
+            // 1 to 4 pick the tiers from the weakest to the strongest
+            if (event.key.code >= sf::Keyboard::Num1 && event.key.code < sf::Keyboard::Num1 + engine::difficultyCount) {
+                selectDifficulty(static_cast<State::Difficulty>(event.key.code - sf::Keyboard::Num1));
+            }
+            break;
+        default:
+            break;
     }
 }
 
+void DifficultySelection::selectDifficulty(const State::Difficulty difficulty) {
+    State::difficulty = difficulty;
+    State::changeScreen(Screens::FleetPlacement);
+}
+
 void DifficultySelection::render() {
     sf::RenderWindow &gui = *State::gui;
     gui.clear();
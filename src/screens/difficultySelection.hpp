@@ -30,17 +30,24 @@ namespace screen {
 
         // SFML event loop helpers
         void update() override;
-        void poll() override;
+        void handleEvent(const sf::Event &event) override;
         void render() override;
 
+        // Plays against the given tier
+        static void selectDifficulty(State::Difficulty difficulty);
+
         // Names to refer to resources on this screen
         enum textureNames {
             BackgroundTexture,
 
             IdleEasyButtonTexture,
             ActiveEasyButtonTexture,
+            IdleMediumButtonTexture,
+            ActiveMediumButtonTexture,
             IdleHardButtonTexture,
             ActiveHardButtonTexture,
+            IdleExpertButtonTexture,
+            ActiveExpertButtonTexture,
             IdleBackButtonTexture,
             ActiveBackButtonTexture,
             IdleInstructionsButtonTexture,
@@ -51,7 +58,9 @@ namespace screen {
         };
         enum buttonNames {
             EasyButton,
+            MediumButton,
             HardButton,
+            ExpertButton,
             BackButton,
             InstructionsButton
         };
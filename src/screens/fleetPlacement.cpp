@@ -3,6 +3,7 @@
  */
 
 #include "fleetPlacement.hpp"
+#include "../engine/fleetLayout.hpp"
 #include "gameplay.hpp"
 
 using screen::FleetPlacement;
@@ -62,88 +63,8 @@ class FleetPlacement &screen::FleetPlacement::getInstance() {
     return *instance;
 }
 
-void FleetPlacement::addCoord(vector<Coordinate> &coordinates, const int x, const int y) {
-    if (x >= 0 && x < Grid::size && y >= 0 && y < Grid::size) {
-        coordinates.emplace_back(x, y);
-    }
-}
-
-
 void FleetPlacement::randomize() {
-    // Start with a temporary grid of open spots (false = not occupied)
-    bool grid[Grid::size][Grid::size];
-    for (auto &row : grid) {
-        for (bool &square : row) {
-            square = false;
-        }
-    }
-
-    // The order the ships are randomly deployed in
-    static shipNames allShips[6] = {
-            shipNames::Battleship,
-            shipNames::AircraftCarrier,
-            shipNames::Destroyer,
-            shipNames::Submarine,
-            shipNames::PatrolBoat,
-            shipNames::RowBoat,
-    };
-    for (shipNames ship : allShips) {
-        int size = shipSize(ship);
-        while (true) {
-            bool horizontal = randomInt(0, 1) % 2 != 0;// Whether the ship is horizontal or vertical
-
-            // Determine a random x and y position for the ship (it will be on the board, but might already be occupied)
-            const int maxBoardIndex = Grid::size - 1;  // The maximum coordinate index on the board
-            const int maxShipStart = Grid::size - size;// The maximum coordinate index to start the ship at so that it fits on the board
-            int x = randomInt(0, horizontal ? maxShipStart : maxBoardIndex);
-            int y = randomInt(0, horizontal ? maxBoardIndex : maxShipStart);
-
-            // Create a list of square to check
-            vector<Coordinate> shipSquares;// Squares occupied by this ship and adjacent ones
-
-            if (horizontal) {
-                for (int i = 0; i < size; ++i) {
-                    addCoord(shipSquares, x + i, y);// Actual ship
-                }
-                addCoord(shipSquares, x - 1, y);// Square left of the leftmost part
-                for (int i = 0; i < size; ++i) {
-                    addCoord(shipSquares, x + i, y - 1);// 1 square above
-                    addCoord(shipSquares, x + i, y + 1);// 1 square below
-                }
-                addCoord(shipSquares, x + size, y);// Square right of the rightmost part
-            } else {
-                for (int i = 0; i < size; ++i) {
-                    addCoord(shipSquares, x, y + i);// Actual ship
-                }
-                addCoord(shipSquares, x, y - 1);// Square above the topmost part
-                for (int i = 0; i < size; ++i) {
-                    addCoord(shipSquares, x - 1, y + i);// 1 square left
-                    addCoord(shipSquares, x + 1, y + i);// 1 square right
-                }
-                addCoord(shipSquares, x, y + size);// Square below the bottom part
-            }
-
-            // Check if all the ship squares are available
-            bool invalid = false;
-            for (Coordinate c : shipSquares) {
-                if (grid[c.getY()][c.getX()]) {
-                    invalid = true;
-                    break;
-                }
-            }
-            if (invalid) continue;// If not, try again
-
-            // The ship is valid; now place it down
-            ships[ship] = {shipSquares.at(0), horizontal};// Ship coordinate and orientation
-            for (int i = 0; i < size; ++i) {
-                // Only set the actual squares this ship is occupying
-                // It is ok if there is only one square in between ships
-                Coordinate curr = shipSquares.at(i);
-                grid[curr.getY()][curr.getX()] = true;
-            }
-            break;
-        }
-    }
+    this->ships = engine::toFleetLayout(engine::randomFleet());
 }
 
 void FleetPlacement::updateFleetLayout() {
@@ -174,6 +95,7 @@ void FleetPlacement::updateFleetLayout() {
             sprite.setRotation(0);
         }
     }
+    this->staticLayer.invalidate();
 }
 
 void FleetPlacement::resetFleetLayout() {
@@ -191,60 +113,51 @@ void FleetPlacement::resetFleetLayout() {
         resources.getSprite(ship.first).setPosition(ship.second);
         resources.getSprite(ship.first).setRotation(0);
     }
+    this->staticLayer.invalidate();
 }
 
 void FleetPlacement::update() {
     const sf::Vector2f mousePosition = State::getMousePosition();
 
-    for (int button = Ready; button <= Instructions; ++button) {
-        resources.getButton(button).updateButtonState(mousePosition);
-    }
+    if (resources.updateButtons(mousePosition)) invalidate();
 }
 
-void FleetPlacement::poll() {
-    sf::RenderWindow &gui = *State::gui;
-    sf::Event &event = State::event;
-
-    while (gui.pollEvent(event)) {
-        switch (event.type) {
-            case sf::Event::Closed:
-                gui.close();
-                break;
-            case sf::Event::MouseButtonReleased:
-                if (event.mouseButton.button != sf::Mouse::Left) break;
-
-                if (resources.getButton(Ready).getButtonState()) {
-                    class Gameplay &gameplayInstance = Gameplay::getInstance();
-                    if (State::gameMode == State::GameMode::SINGLE_PLAYER) {
+void FleetPlacement::handleEvent(const sf::Event &event) {
+    switch (event.type) {
+        case sf::Event::MouseButtonReleased:
+            if (event.mouseButton.button != sf::Mouse::Left) break;
+
+            if (resources.getButton(Ready).getButtonState()) {
+                class Gameplay &gameplayInstance = Gameplay::getInstance();
+                if (State::gameMode == State::GameMode::SINGLE_PLAYER) {
+                    gameplayInstance.setP1Grid(ships);
+                    this->resetFleetLayout();
+                    this->layoutGenerated = false;
+                    this->randomize();
+                    gameplayInstance.setP2Grid(ships);
+                    State::changeScreen(Screens::Gameplay);
+                } else {
+                    if (State::player == State::Player::P1) {
                         gameplayInstance.setP1Grid(ships);
-                        this->resetFleetLayout();
-                        this->layoutGenerated = false;
-                        this->randomize();
-                        gameplayInstance.setP2Grid(ships);
-                        State::changeScreen(Screens::Gameplay);
+                        State::player = State::Player::P2;
                     } else {
-                        if (State::player == State::Player::P1) {
-                            gameplayInstance.setP1Grid(ships);
-                            State::player = State::Player::P2;
-                        } else {
-                            gameplayInstance.setP2Grid(ships);
-                            State::player = State::Player::P1;
-                        }
-                        this->resetFleetLayout();
-                        this->layoutGenerated = false;
-                        State::changeScreen(Screens::Intermediary);
+                        gameplayInstance.setP2Grid(ships);
+                        State::player = State::Player::P1;
                     }
-                } else if (resources.getButton(Randomize).getButtonState()) {
-                    this->randomize();
-                    this->updateFleetLayout();
-                    this->layoutGenerated = true;
-                } else if (resources.getButton(Instructions).getButtonState()) {
-                    State::changeScreen(Screens::Instructions);
+                    this->resetFleetLayout();
+                    this->layoutGenerated = false;
+                    State::changeScreen(Screens::Intermediary);
                 }
-                break;
-            default:
-                break;
-        }
+            } else if (resources.getButton(Randomize).getButtonState()) {
+                this->randomize();
+                this->updateFleetLayout();
+                this->layoutGenerated = true;
+            } else if (resources.getButton(Instructions).getButtonState()) {
+                State::changeScreen(Screens::Instructions);
+            }
+            break;
+        default:
+            break;
     }
 }
 
@@ -252,25 +165,28 @@ void FleetPlacement::render() {
     sf::RenderWindow &gui = *State::gui;
     gui.clear();
 
-    if (State::gameMode == State::SINGLE_PLAYER) {
-        gui.draw(resources.getSprite(BackgroundDefault));
-    } else {
-        if (State::player == State::Player::P1) {
-            gui.draw(resources.getSprite(BackgroundP1));
+    // The background and ships only change when the fleet is moved or the player changes
+    this->staticLayer.render(gui, State::gameMode * 2 + State::player, [this](sf::RenderTarget &layer) {
+        if (State::gameMode == State::SINGLE_PLAYER) {
+            layer.draw(resources.getSprite(BackgroundDefault));
         } else {
-            gui.draw(resources.getSprite(BackgroundP2));
+            if (State::player == State::Player::P1) {
+                layer.draw(resources.getSprite(BackgroundP1));
+            } else {
+                layer.draw(resources.getSprite(BackgroundP2));
+            }
         }
-    }
+
+        // Render ships
+        for (int ship = Battleship; ship <= RowBoat; ++ship) {
+            layer.draw(resources.getSprite(ship));
+        }
+    });
 
     // Render buttons
     if (layoutGenerated) resources.getButton(Ready).render(gui);
     resources.getButton(Randomize).render(gui);
     resources.getButton(Instructions).render(gui);
 
-    // Render ships
-    for (int ship = Battleship; ship <= RowBoat; ++ship) {
-        gui.draw(resources.getSprite(ship));
-    }
-
     gui.display();
 }
@@ -7,6 +7,7 @@
 
 #include "../controllers/screenTemplate.hpp"
 #include "../entity/coordinate.hpp"
+#include "../entity/layerCache.hpp"
 
 using entity::Coordinate;
 
@@ -33,7 +34,7 @@ namespace screen {
 
         // SFML event loop helpers
         void update() override;
-        void poll() override;
+        void handleEvent(const sf::Event &event) override;
         void render() override;
 
         // Names to refer to resources on this screen
@@ -80,8 +81,8 @@ namespace screen {
         // If a ship orientation has been generated yet
         bool layoutGenerated;
 
-        // Adds a coordinate to a vector if it is within the grid's bounds
-        static void addCoord(vector<Coordinate> &coordinates, int x, int y);
+        // The background and ships (only redrawn when the fleet layout changes)
+        entity::LayerCache staticLayer;
 
         // Generates a random fleet layout
         void randomize();
@@ -45,40 +45,28 @@ class GameModeSelection &screen::GameModeSelection::getInstance() {
 
 void GameModeSelection::update() {
     sf::Vector2f mousePosition = State::getMousePosition();
-
-    // Update every button's state
-    for (int i = OnePlayer; i <= Instructions; ++i) {
-        resources.getButton(i).updateButtonState(mousePosition);
-    }
+    if (resources.updateButtons(mousePosition)) invalidate();
 }
 
-void GameModeSelection::poll() {
-    sf::RenderWindow &gui = *State::gui;
-    sf::Event &event = State::event;
-
-    while (gui.pollEvent(event)) {
-        switch (event.type) {
-            case sf::Event::Closed:
-                gui.close();
-                break;
-            case sf::Event::MouseButtonReleased:
-                if (event.mouseButton.button != sf::Mouse::Left) break;
+void GameModeSelection::handleEvent(const sf::Event &event) {
+    switch (event.type) {
+        case sf::Event::MouseButtonReleased:
+            if (event.mouseButton.button != sf::Mouse::Left) break;
 
-                if (resources.getButton(OnePlayer).getButtonState()) {
-                    State::gameMode = State::GameMode::SINGLE_PLAYER;
-                    State::changeScreen(Screens::DifficultySelection);
-                } else if (resources.getButton(TwoPlayers).getButtonState()) {
-                    State::gameMode = State::GameMode::MULTI_PLAYER;
-                    State::changeScreen(Screens::FleetPlacement);
-                } else if (resources.getButton(Back).getButtonState()) {
-                    State::previousScreen();
-                } else if (resources.getButton(Instructions).getButtonState()) {
-                    State::changeScreen(Screens::Instructions);
-                }
-                break;
-            default:
-                break;
-        }
+            if (resources.getButton(OnePlayer).getButtonState()) {
+                State::gameMode = State::GameMode::SINGLE_PLAYER;
+                State::changeScreen(Screens::DifficultySelection);
+            } else if (resources.getButton(TwoPlayers).getButtonState()) {
+                State::gameMode = State::GameMode::MULTI_PLAYER;
+                State::changeScreen(Screens::FleetPlacement);
+            } else if (resources.getButton(Back).getButtonState()) {
+                State::previousScreen();
+            } else if (resources.getButton(Instructions).getButtonState()) {
+                State::changeScreen(Screens::Instructions);
+            }
+            break;
+        default:
+            break;
     }
 }
 
@@ -43,26 +43,18 @@ class GameOver &screen::GameOver::getInstance() {
 
 void GameOver::update() {
     sf::Vector2f mousePosition = State::getMousePosition();
-    resources.getButton(buttonNames::Homepage).updateButtonState(mousePosition);
+    if (resources.updateButtons(mousePosition)) invalidate();
 }
 
-void GameOver::poll() {
-    sf::RenderWindow &gui = *State::gui;
-    sf::Event &event = State::event;
-
-    while (gui.pollEvent(event)) {
-        switch (event.type) {
-            case sf::Event::Closed:
-                gui.close();
-                break;
-            case sf::Event::MouseButtonReleased:
-                if (event.mouseButton.button == sf::Mouse::Left && resources.getButton(buttonNames::Homepage).getButtonState()) {
-                    State::changeScreen(Screens::Homepage);
-                }
-                break;
-            default:
-                break;
-        }
+void GameOver::handleEvent(const sf::Event &event) {
+    switch (event.type) {
+        case sf::Event::MouseButtonReleased:
+            if (event.mouseButton.button == sf::Mouse::Left && resources.getButton(buttonNames::Homepage).getButtonState()) {
+                State::changeScreen(Screens::Homepage);
+            }
+            break;
+        default:
+            break;
     }
 }
 
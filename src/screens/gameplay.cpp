@@ -2,15 +2,11 @@
  * Stores a player's 10-by-10 grid and their ships
  */
 
-#ifdef _WIN32
-#include <Windows.h>
-#include <memory>
-#else
-#include <unistd.h>
-#endif
-
+#include "../controllers/scheduler.hpp"
+#include "../helpers/AssetBundle.hpp"
 #include "../helpers/helperFunctions.hpp"
 #include "gameplay.hpp"
+#include <sstream>
 
 using entity::SquareType;
 using screen::Gameplay;
@@ -18,6 +14,10 @@ using std::get;
 
 std::unique_ptr<class Gameplay> Gameplay::instance = nullptr;
 
+// Targets are 15 by 15 pixel squares, 16 pixels apart, starting at (128, 28) (all scaled by 5)
+const entity::CellLattice Gameplay::targetLattice(sf::Vector2f(128 * 5, 28 * 5), sf::Vector2f(16 * 5, 16 * 5),
+                                                  sf::Vector2f(15 * 5, 15 * 5), Grid::size, Grid::size);
+
 Gameplay::Gameplay() : ScreenTemplate() {
     // Data required for all the SFML objects on this screen
     const vector<string> texturePaths = {
@@ -49,6 +49,9 @@ Gameplay::Gameplay() : ScreenTemplate() {
             "ActiveSurrenderButton.png",
             "IdleInstructionsButton.png",
             "ActiveInstructionsButton.png",
+
+            "IdlePrimaryTarget.png",
+            "ActivePrimaryTarget.png",
     };
     const vector<sprite> sprites = {
             {sf::Vector2f(0, 0), sf::Vector2f(5, 5), BackgroundDefaultTexture},
@@ -83,30 +86,32 @@ Gameplay::Gameplay() : ScreenTemplate() {
 
 
     // Initialize other required objects
-    gridP1 = std::make_unique<Grid>();
-    gridP2 = std::make_unique<Grid>();
-
     fleetLayoutP1 = std::make_unique<shipOrientations>();
     fleetLayoutP2 = std::make_unique<shipOrientations>();
 
-    Target::initializeTextures("idlePrimaryTarget.png", "ActivePrimaryTarget.png");
+    Target::initializeTextures(resources.getTexture(IdlePrimaryTargetTexture), resources.getTexture(ActivePrimaryTargetTexture));
 
     // Initializes the target locations
-    for (int y = 0; y < 10; ++y) {
-        for (int x = 0; x < 10; ++x) {
-            Coordinate coordinate(x, y);
-            Target target(coordinate, sf::Vector2f((float) (128 + (x * 16)) * 5, (float) (28 + (y * 16)) * 5), sf::Vector2f(5, 5));
-            this->targetVector.push_back(target);
-        }
+    this->targetLayer = SpriteBatch(Grid::size * Grid::size);
+    this->targetVector.reserve(Grid::size * Grid::size);
+    for (int square = 0; square < targetLattice.size(); ++square) {
+        Target target(Coordinate::fromIndex(square), targetLattice.cellPosition(square), sf::Vector2f(5, 5));
+        this->targetLayer.set(square, target.getTexture(), target.getPosition(), target.getScale());
+        this->targetVector.push_back(target);
     }
 
-    // Initialize the set of possible coordinates the environment can attack
-    for (int y = 0; y < 10; ++y) {
-        for (int x = 0; x < 10; ++x) {
-            Coordinate coordinate(x, y);
-            this->coordinateSet.insert(coordinate);
-        }
+    this->sunkShipsLayers[engine::Game::P1] = SpriteBatch(entity::shipCount);
+    this->sunkShipsLayers[engine::Game::P2] = SpriteBatch(entity::shipCount);
+
+    // The opening book is in the asset bundle, or in res/ without one (the computer plays without a book if it is missing)
+    auto book = std::make_shared<engine::OpeningBook>();
+    if (AssetBundle::contains("openings.book")) {
+        std::istringstream stream{string(AssetBundle::data("openings.book"))};
+        engine::OpeningBook::read(stream, *book);
+    } else {
+        engine::OpeningBook::load(resourcesPath + "openings.book", *book);
     }
+    this->openingBook = book;
 }
 
 class Gameplay &screen::Gameplay::getInstance() {
@@ -117,100 +122,75 @@ class Gameplay &screen::Gameplay::getInstance() {
 }
 
 void Gameplay::setP1Grid(const shipOrientations &ships) {
-    gridP1 = std::make_unique<Grid>(ships);
-    fleetLayoutP1.reset(&gridP1->getShips());
+    game.setFleet(engine::Game::P1, ships);
+    fleetLayoutP1 = std::make_unique<shipOrientations>(ships);
+    staticLayer.invalidate();
+
+    // The computer hasn't attacked anything in the new game yet
+    computerMove.cancel();
+    for (std::unique_ptr<engine::Strategy> &computer : computers) {
+        if (computer != nullptr) computer->reset();
+    }
 }
 
 void Gameplay::setP2Grid(const shipOrientations &ships) {
-    gridP2 = std::make_unique<Grid>(ships);
-    fleetLayoutP2.reset(&gridP2->getShips());
-}
-
-Coordinate Gameplay::randomAttack() {
-    // Generate a random index and get to the coordinate at that position
-    const int randGen = randomInt(0, (int) this->coordinateSet.size() - 1);
-    auto itr = this->coordinateSet.begin();
-    advance(itr, randGen);
-
-    // Remove the coordinate from the set and return it
-    this->coordinateSet.erase(itr);
-    return *itr;
+    game.setFleet(engine::Game::P2, ships);
+    fleetLayoutP2 = std::make_unique<shipOrientations>(ships);
+    staticLayer.invalidate();
 }
 
-bool Gameplay::lost(Grid &grid) {
-    map<shipNames, bool> shipStatus = grid.getShipStatus();
-    return std::all_of(shipStatus.cbegin(), shipStatus.cend(), [](const auto &ship) { return ship.second; });
+bool Gameplay::lost(const Grid &grid) {
+    return grid.allSunk();
 }
 
 void Gameplay::updateGridMarkers(SquareType attack, Coordinate coordinate) {
+    const bool hit = attack != SquareType::Water;
+    const int primaryMarker = hit ? PrimaryHitMarker : PrimaryMissMarker;
+    const int primaryTexture = hit ? PrimaryHitMarkerTexture : PrimaryMissMarkerTexture;
+    const int secondaryMarker = hit ? SecondaryHitMarker : SecondaryMissMarker;
+    const int secondaryTexture = hit ? SecondaryHitMarkerTexture : SecondaryMissMarkerTexture;
+
     if (State::gameMode == State::GameMode::SINGLE_PLAYER) {
         if (State::player == State::Player::P1) {
-            if (attack == SquareType::Water) {
-                resources.getSprite(PrimaryMissMarker)
-                        .setPosition(sf::Vector2f((float) ((128 + (coordinate.getX() * 16)) * 5), (float) ((28 + (coordinate.getY() * 16)) * 5)));
-                this->primaryMarkersP1Vector.push_back(resources.getSprite(PrimaryMissMarker));
-            } else {
-                resources.getSprite(PrimaryHitMarker)
-                        .setPosition(sf::Vector2f((float) ((128 + (coordinate.getX() * 16)) * 5), (float) ((28 + (coordinate.getY() * 16)) * 5)));
-                this->primaryMarkersP1Vector.push_back(resources.getSprite(PrimaryHitMarker));
-            }
+            addMarker(primaryMarkers[engine::Game::P1], primaryMarker, primaryTexture, coordinate, primaryMarkerPosition(coordinate));
         } else {
-            if (attack == SquareType::Water) {
-                resources.getSprite(SecondaryMissMarker)
-                        .setPosition(sf::Vector2f((float) ((16 + (coordinate.getX() * 8)) * 5), (float) ((44 + (coordinate.getY() * 8)) * 5)));
-                this->secondaryMarkersP1Vector.push_back(resources.getSprite(SecondaryMissMarker));
-            } else {
-                resources.getSprite(SecondaryHitMarker)
-                        .setPosition(sf::Vector2f((float) ((16 + (coordinate.getX() * 8)) * 5), (float) ((44 + (coordinate.getY() * 8)) * 5)));
-                this->secondaryMarkersP1Vector.push_back(resources.getSprite(SecondaryHitMarker));
-            }
+            addMarker(secondaryMarkers[engine::Game::P1], secondaryMarker, secondaryTexture, coordinate, secondaryMarkerPosition(coordinate));
         }
     } else {
         if (State::player == State::Player::P1) {
-            if (attack == SquareType::Water) {
-                resources.getSprite(PrimaryMissMarker)
-                        .setPosition(sf::Vector2f((float) ((128 + (coordinate.getX() * 16)) * 5), (float) ((28 + (coordinate.getY() * 16)) * 5)));
-                this->primaryMarkersP1Vector.push_back(resources.getSprite(PrimaryMissMarker));
-
-                resources.getSprite(SecondaryMissMarker)
-                        .setPosition(sf::Vector2f((float) ((16 + (coordinate.getX() * 8)) * 5), (float) ((44 + (coordinate.getY() * 8)) * 5)));
-                this->secondaryMarkersP2Vector.push_back(resources.getSprite(SecondaryMissMarker));
-            } else {
-                resources.getSprite(PrimaryHitMarker)
-                        .setPosition(sf::Vector2f((float) ((128 + (coordinate.getX() * 16)) * 5), (float) ((28 + (coordinate.getY() * 16)) * 5)));
-                this->primaryMarkersP1Vector.push_back(resources.getSprite(PrimaryHitMarker));
-
-                resources.getSprite(SecondaryHitMarker)
-                        .setPosition(sf::Vector2f((float) ((16 + (coordinate.getX() * 8)) * 5), (float) ((44 + (coordinate.getY() * 8)) * 5)));
-                this->secondaryMarkersP2Vector.push_back(resources.getSprite(SecondaryHitMarker));
-            }
+            addMarker(primaryMarkers[engine::Game::P1], primaryMarker, primaryTexture, coordinate, primaryMarkerPosition(coordinate));
+            addMarker(secondaryMarkers[engine::Game::P2], secondaryMarker, secondaryTexture, coordinate, secondaryMarkerPosition(coordinate));
         } else {
-            if (attack == SquareType::Water) {
-                resources.getSprite(PrimaryMissMarker).
-                        setPosition(sf::Vector2f((float) ((128 + (coordinate.getX() * 16)) * 5), (float) ((28 + (coordinate.getY() * 16)) * 5)));
-                this->primaryMarkersP2Vector.push_back(resources.getSprite(PrimaryMissMarker));
-
-                resources.getSprite(SecondaryMissMarker)
-                        .setPosition(sf::Vector2f((float) ((16 + (coordinate.getX() * 8)) * 5), (float) ((44 + (coordinate.getY() * 8)) * 5)));
-                this->secondaryMarkersP1Vector.push_back(resources.getSprite(SecondaryMissMarker));
-            } else {
-                resources.getSprite(PrimaryHitMarker)
-                        .setPosition(sf::Vector2f((float) ((128 + (coordinate.getX() * 16)) * 5), (float) ((28 + (coordinate.getY() * 16)) * 5)));
-                this->primaryMarkersP2Vector.push_back(resources.getSprite(PrimaryHitMarker));
-
-                resources.getSprite(SecondaryHitMarker)
-                        .setPosition(sf::Vector2f((float) ((16 + (coordinate.getX() * 8)) * 5), (float) ((44 + (coordinate.getY() * 8)) * 5)));
-                this->secondaryMarkersP1Vector.push_back(resources.getSprite(SecondaryHitMarker));
-            }
+            addMarker(primaryMarkers[engine::Game::P2], primaryMarker, primaryTexture, coordinate, primaryMarkerPosition(coordinate));
+            addMarker(secondaryMarkers[engine::Game::P1], secondaryMarker, secondaryTexture, coordinate, secondaryMarkerPosition(coordinate));
         }
     }
+
+    // The attacked grid may have a new sunken ship
+    this->updateSunkShips(State::player == State::Player::P1 ? engine::Game::P2 : engine::Game::P1);
+    this->staticLayer.invalidate();
+}
+
+void Gameplay::addMarker(MarkerBoard &markers, const int marker, const int texture, const Coordinate coordinate, const sf::Vector2f position) {
+    markers.add(coordinate, resources.getTexture(texture), position, resources.getSprite(marker).getScale());
+}
+
+sf::Vector2f Gameplay::primaryMarkerPosition(const Coordinate coordinate) {
+    return {(float) ((128 + (coordinate.getX() * 16)) * 5), (float) ((28 + (coordinate.getY() * 16)) * 5)};
+}
+
+sf::Vector2f Gameplay::secondaryMarkerPosition(const Coordinate coordinate) {
+    return {(float) ((16 + (coordinate.getX() * 8)) * 5), (float) ((44 + (coordinate.getY() * 8)) * 5)};
 }
 
 void Gameplay::resetGridMarkers() {
-    this->primaryMarkersP1Vector.clear();
-    this->primaryMarkersP2Vector.clear();
-    this->secondaryMarkersP1Vector.clear();
-    this->secondaryMarkersP2Vector.clear();
+    for (const engine::Game::Player player : {engine::Game::P1, engine::Game::P2}) {
+        this->primaryMarkers[player].clear();
+        this->secondaryMarkers[player].clear();
+    }
+    this->sunkShipsLayers[engine::Game::P1].clear();
+    this->sunkShipsLayers[engine::Game::P2].clear();
+    this->staticLayer.invalidate();
 }
 
 void Gameplay::updateSecondaryTarget(Coordinate coordinate) {
@@ -218,94 +198,37 @@ void Gameplay::updateSecondaryTarget(Coordinate coordinate) {
 }
 
 void Gameplay::attack(Coordinate &coordinate) {
-    if (State::gameMode == State::GameMode::SINGLE_PLAYER) {
-        if (State::player == State::Player::P1) {
-            SquareType attack = this->gridP2->attack(coordinate);
-            if (attack == SquareType::Water) {
-                this->updateGridMarkers(attack, coordinate);
-                this->render();
-                sleepMS();
-                State::player = State::Player::P2;
-            } else if (attack == SquareType::Ship) {
-                this->updateGridMarkers(attack, coordinate);
-                this->render();
-                sleepMS();
-                if (lost(*(this->gridP2))) {
-                    this->resetGridMarkers();
-                    State::player = State::Player::P2;
-                    State::changeScreen(Screens::GameOver);
-                } else {
-                    State::player = State::Player::P2;
-                }
-            }
-        } else {
-            SquareType attack = this->gridP1->attack(coordinate);
-            if (attack == SquareType::Water) {
-                this->updateGridMarkers(attack, coordinate);
-                this->updateSecondaryTarget(coordinate);
-                State::player = State::Player::P1;
-            } else if (attack == SquareType::Ship) {
-                this->updateGridMarkers(attack, coordinate);
-                this->updateSecondaryTarget(coordinate);
-                if (lost(*(this->gridP1))) {
-                    this->resetGridMarkers();
-                    State::player = State::Player::P1;
-                    State::changeScreen(Screens::GameOver);
-                } else {
-                    State::player = State::Player::P1;
-                }
-            }
+    const bool computerTurn = State::gameMode == State::GameMode::SINGLE_PLAYER && State::player == State::Player::P2;
+    const engine::Game::Player attacker = State::player == State::Player::P1 ? engine::Game::P1 : engine::Game::P2;
+
+    // Attacking a square that was already attacked does nothing
+    SquareType attack = this->game.attack(attacker, coordinate);
+    if (attack != SquareType::Water && attack != SquareType::Ship) return;
+
+    this->updateGridMarkers(attack, coordinate);
+    invalidate();
+
+    // Hands the turn over, or ends the game if the attack sank the last ship
+    auto endTurn = [this, coordinate, attacker, computerTurn]() {
+        if (State::gameMode == State::GameMode::MULTI_PLAYER || computerTurn) {
+            this->updateSecondaryTarget(coordinate);
         }
-    } else {
-        if (State::player == State::Player::P1) {
-            SquareType attack = this->gridP2->attack(coordinate);
-            if (attack == SquareType::Water) {
-                this->updateGridMarkers(attack, coordinate);
-                this->render();
-                this->updateSecondaryTarget(coordinate);
-                sleepMS();
-                State::player = State::Player::P2;
-                State::changeScreen(Screens::Intermediary);
-            } else if (attack == SquareType::Ship) {
-                this->updateGridMarkers(attack, coordinate);
-                this->render();
-                this->updateSecondaryTarget(coordinate);
-                sleepMS();
-                if (lost(*(this->gridP2))) {
-                    this->resetGridMarkers();
-                    State::player = State::Player::P2;
-                    State::changeScreen(Screens::GameOver);
-                } else {
-                    State::player = State::Player::P2;
-                    State::changeScreen(Screens::Intermediary);
-                }
-            }
 
-        } else {
-            SquareType attack = this->gridP1->attack(coordinate);
-            if (attack == SquareType::Water) {
-                this->updateGridMarkers(attack, coordinate);
-                this->render();
-                this->updateSecondaryTarget(coordinate);
-                sleepMS();
-                State::player = State::Player::P1;
-                State::changeScreen(Screens::Intermediary);
-            } else if (attack == SquareType::Ship) {
-                this->updateGridMarkers(attack, coordinate);
-                this->render();
-                this->updateSecondaryTarget(coordinate);
-                if (lost(*(this->gridP1))) {
-                    sleepMS();
-                    this->resetGridMarkers();
-                    State::player = State::Player::P1;
-                    State::changeScreen(Screens::GameOver);
-                } else {
-                    sleepMS();
-                    State::player = State::Player::P1;
-                    State::changeScreen(Screens::Intermediary);
-                }
-            }
+        State::player = attacker == engine::Game::P1 ? State::Player::P2 : State::Player::P1;
+        if (lost(this->game.getGrid(engine::Game::opponent(attacker)))) {
+            this->resetGridMarkers();
+            State::changeScreen(Screens::GameOver);
+        } else if (State::gameMode == State::GameMode::MULTI_PLAYER) {
+            State::changeScreen(Screens::Intermediary);
         }
+        invalidate();
+    };
+
+    // Let the player see the result of their attack before the turn ends (the computer's attacks show immediately)
+    if (computerTurn) {
+        endTurn();
+    } else {
+        Scheduler::after(sf::milliseconds(turnDelayMS), endTurn);
     }
 }
 
@@ -342,11 +265,15 @@ void Gameplay::setFleetLayout(shipOrientations &fleetLayout) {
 void Gameplay::update() {
     sf::Vector2f mousePosition = State::getMousePosition();
 
-    resources.getButton(Surrender).updateButtonState(mousePosition);
-    resources.getButton(Instructions).updateButtonState(mousePosition);
+    if (resources.updateButtons(mousePosition)) invalidate();
 
-    for (auto &target : this->targetVector) {
-        target.updateTargetState(mousePosition);
+    // Only the previously and newly hovered targets change
+    const int hovered = targetLattice.cellAt(mousePosition);
+    if (hovered != this->hoveredTarget) {
+        if (this->hoveredTarget != -1) this->setTargetState(this->hoveredTarget, false);
+        if (hovered != -1) this->setTargetState(hovered, true);
+        this->hoveredTarget = hovered;
+        invalidate();
     }
 
     if (State::gameMode == State::GameMode::SINGLE_PLAYER || State::player == State::Player::P1) {
@@ -355,57 +282,66 @@ void Gameplay::update() {
         this->setFleetLayout(*this->fleetLayoutP2);
     }
 
+    // The computer decides on a worker thread, and attacks once it has decided
     if (State::gameMode == State::GameMode::SINGLE_PLAYER && State::player == State::Player::P2) {
-        if (State::difficulty == State::Difficulty::EASY) {
-            Coordinate attack = this->randomAttack();
-            this->attack(attack);
-        } else {
-            // TODO: Add hard algorithm
-            Coordinate attack = this->randomAttack();
-            this->attack(attack);
+        if (!this->computerMove.running()) {
+            // Each difficulty's computer is created the first time it plays
+            std::unique_ptr<engine::Strategy> &computer = this->computers[State::difficulty];
+            if (computer == nullptr) {
+                computer = engine::makeStrategy(State::difficulty, std::thread::hardware_concurrency(), this->openingBook);
+            }
+            this->computerMove.start(*computer, this->game.getGrid(engine::Game::P1));
+        } else if (std::optional<Coordinate> attack = this->computerMove.poll()) {
+            engine::recordMoveTime(State::difficulty, this->computerMove.lastDuration());
+            this->attack(*attack);
         }
     }
 
-    State::lockedFlag = false;
+    // No attacks until the current turn is over
+    State::lockedFlag = Scheduler::pending() || this->computerMove.running();
 }
 
-void Gameplay::poll() {
-    sf::RenderWindow &gui = *State::gui;
-    sf::Event &event = State::event;
+void Gameplay::setTargetState(const int index, const bool active) {
+    Target &target = this->targetVector[index];
+    if (target.setTargetState(active)) {
+        this->targetLayer.set(index, target.getTexture(), target.getPosition(), target.getScale());
+    }
+}
 
-    while (gui.pollEvent(event)) {
-        switch (event.type) {
-            case sf::Event::Closed:
-                gui.close();
-                break;
-            case sf::Event::MouseButtonReleased:
-                if (event.mouseButton.button == sf::Mouse::Left) {
-                    if (resources.getButton(Surrender).getButtonState()) {
-                        this->resetGridMarkers();
-                        State::changeScreen(Screens::GameOver);
-                    } else if (resources.getButton(Instructions).getButtonState()) {
-                        State::changeScreen(Screens::Instructions);
-                    } else if (!State::lockedFlag) {
-                        for (auto &target : this->targetVector) {
-                            if (target.getTargetState()) {
-                                State::lockedFlag = true;
-                                Coordinate targetCoord = target.getTargetCoordinate();
-                                this->attack(targetCoord);
-                            }
-                        }
-                    }
-                    break;
+bool Gameplay::animating() const {
+    // The computer takes its turn without any user input
+    return State::gameMode == State::GameMode::SINGLE_PLAYER && State::player == State::Player::P2;
+}
+
+void Gameplay::handleEvent(const sf::Event &event) {
+    switch (event.type) {
+        case sf::Event::Closed:
+            this->computerMove.cancel();
+            break;
+        case sf::Event::MouseButtonReleased:
+            if (event.mouseButton.button == sf::Mouse::Left) {
+                if (resources.getButton(Surrender).getButtonState()) {
+                    // The turn that was ending or being decided is abandoned
+                    Scheduler::clear();
+                    this->computerMove.cancel();
+                    this->resetGridMarkers();
+                    State::changeScreen(Screens::GameOver);
+                } else if (resources.getButton(Instructions).getButtonState()) {
+                    // The end of the turn changes screen itself, so the instructions wait until it has run
+                    if (!Scheduler::pending()) State::changeScreen(Screens::Instructions);
+                } else if (!State::lockedFlag && this->hoveredTarget != -1) {// Attacks wait until the turn ends
+                    State::lockedFlag = true;
+                    Coordinate targetCoord = this->targetVector[this->hoveredTarget].getTargetCoordinate();
+                    this->attack(targetCoord);
                 }
-            default:
                 break;
-        }
+            }
+        default:
+            break;
     }
 }
 
-void Gameplay::renderSunkShips(Grid &grid) {
-    sf::RenderWindow &gui = *State::gui;
-    map<shipNames, bool> isSunk = grid.getShipStatus();
-
+void Gameplay::updateSunkShips(const engine::Game::Player player) {
     static const map<int, shipNames> ships = {
             {BattleShipSunk, shipNames::Battleship},
             {AircraftCarrierSunk, shipNames::AircraftCarrier},
@@ -415,12 +351,18 @@ void Gameplay::renderSunkShips(Grid &grid) {
             {RowBoatSunk, shipNames::RowBoat},
     };
 
+    const Grid &grid = this->game.getGrid(player);
+    SpriteBatch &layer = this->sunkShipsLayers[player];
     for (auto ship : ships) {
-        const int sunkTexture = ship.first;
+        const int sunkSprite = ship.first;
         const shipNames name = ship.second;
+        const size_t slot = sunkSprite - BattleShipSunk;
 
-        if (isSunk[name]) {
-            gui.draw(resources.getSprite(sunkTexture));
+        if (grid.isSunk(name)) {
+            const sf::Sprite &sprite = resources.getSprite(sunkSprite);
+            layer.set(slot, resources.getTexture(BattleshipSunkTexture + (int) slot), sprite.getPosition(), sprite.getScale());
+        } else {
+            layer.clear(slot);
         }
     }
 }
@@ -429,65 +371,40 @@ void Gameplay::render() {
     sf::RenderWindow &gui = *State::gui;
     gui.clear();
 
-    // Background rendering
-    if (State::gameMode == State::SINGLE_PLAYER) {
-        gui.draw(resources.getSprite(BackgroundDefault));
-    } else {
-        if (State::player == State::Player::P1) {
-            gui.draw(resources.getSprite(BackgroundP1));
+    // The background, ships, sunk ships and markers only change when a player attacks or the turn changes
+    const bool showP1 = State::gameMode == State::SINGLE_PLAYER || State::player == State::Player::P1;
+    const engine::Game::Player shown = showP1 ? engine::Game::P1 : engine::Game::P2;
+    this->staticLayer.render(gui, State::gameMode * 2 + State::player, [this, shown](sf::RenderTarget &layer) {
+        if (State::gameMode == State::SINGLE_PLAYER) {
+            layer.draw(resources.getSprite(BackgroundDefault));
         } else {
-            gui.draw(resources.getSprite(BackgroundP2));
+            if (State::player == State::Player::P1) {
+                layer.draw(resources.getSprite(BackgroundP1));
+            } else {
+                layer.draw(resources.getSprite(BackgroundP2));
+            }
         }
-    }
 
-    // Buttons and ships
-    resources.getButton(Surrender).render(gui);
-    resources.getButton(Instructions).render(gui);
-
-    for (int ship = Battleship; ship <= RowBoat; ++ship) {
-        gui.draw(resources.getSprite(ship));
-    }
+        for (int ship = Battleship; ship <= RowBoat; ++ship) {
+            layer.draw(resources.getSprite(ship));
+        }
 
-    if (State::gameMode == State::SINGLE_PLAYER || State::player == State::Player::P1) {
-        this->renderSunkShips(*(this->gridP2));
-    } else {
-        this->renderSunkShips(*(this->gridP1));
-    }
+        // Renders the sunk ships and all the target markers (one draw call per layer)
+        this->sunkShipsLayers[engine::Game::opponent(shown)].render(layer);
+        this->primaryMarkers[shown].render(layer);
+        this->secondaryMarkers[shown].render(layer);
+    });
 
-    // Renders all the target markers
-    vector<sf::Sprite> primaryMarkers, secondaryMarkers;
-    if (State::gameMode == State::SINGLE_PLAYER || State::player == State::Player::P1) {
-        primaryMarkers = primaryMarkersP1Vector;
-        secondaryMarkers = secondaryMarkersP1Vector;
-    } else {
-        primaryMarkers = primaryMarkersP2Vector;
-        secondaryMarkers = secondaryMarkersP2Vector;
-    }
-    for (auto &primaryMarker : primaryMarkers) {
-        gui.draw(primaryMarker);
-    }
-    for (auto &secondaryMarker : secondaryMarkers) {
-        gui.draw(secondaryMarker);
-    }
+    // Buttons
+    resources.getButton(Surrender).render(gui);
+    resources.getButton(Instructions).render(gui);
 
-    if (State::player == State::Player::P1 && !this->secondaryMarkersP1Vector.empty()) {
-        gui.draw(resources.getSprite(SecondaryTarget));
-    }
-    if (State::player == State::Player::P2 && !this->secondaryMarkersP2Vector.empty()) {
+    const MarkerBoard &ownMarkers = this->secondaryMarkers[State::player == State::Player::P1 ? engine::Game::P1 : engine::Game::P2];
+    if (!ownMarkers.empty()) {
         gui.draw(resources.getSprite(SecondaryTarget));
     }
 
-    for (auto &target : this->targetVector) {
-        target.render(gui);
-    }
+    this->targetLayer.render(gui);
 
     gui.display();
 }
-
-void screen::Gameplay::sleepMS() {
-#ifdef _WIN32
-    Sleep(sleepTimeMS);
-#else
-    usleep(sleepTimeMS * 1000);
-#endif// _WIN32
-}
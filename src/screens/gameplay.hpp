@@ -6,17 +6,23 @@
 #define BATTLESHIP_GAMEPLAY_H
 
 #include "../controllers/screenTemplate.hpp"
-#include "../entity/grid.hpp"
+#include "../engine/game.hpp"
+#include "../engine/asyncMove.hpp"
+#include "../engine/difficulty.hpp"
+#include "../entity/cellLattice.hpp"
+#include "../entity/layerCache.hpp"
+#include "../entity/markerBoard.hpp"
+#include "../entity/spriteBatch.hpp"
 #include "../entity/target.hpp"
-#include <set>
 
 using entity::Grid;
+using entity::MarkerBoard;
+using entity::SpriteBatch;
 using entity::SquareType;
 using entity::Target;
-using std::set;
 
 //Orientation of ships: Its name, top left coordinate and if it's horizontal
-typedef map<shipNames, tuple<Coordinate, bool>> shipOrientations;
+typedef engine::FleetLayout shipOrientations;
 
 namespace screen {
     class Gameplay : public ScreenTemplate {
@@ -27,7 +33,7 @@ namespace screen {
         static Gameplay &getInstance();
 
         /**
-         * Initializes P1's grid
+         * Initializes P1's grid (this starts a new game)
          */
         void setP1Grid(const shipOrientations &ships);
 
@@ -51,8 +57,9 @@ namespace screen {
 
         // SFML event loop helpers
         void update() override;
-        void poll() override;
+        void handleEvent(const sf::Event &event) override;
         void render() override;
+        bool animating() const override;
 
         // Names to refer to resources on this screen
         enum textureNames {
@@ -83,7 +90,10 @@ namespace screen {
             IdleSurrenderButtonTexture,
             ActiveSurrenderButtonTexture,
             IdleInstructionsButtonTexture,
-            ActiveInstructionsButtonTexture
+            ActiveInstructionsButtonTexture,
+
+            IdlePrimaryTargetTexture,
+            ActivePrimaryTargetTexture
         };
         enum spriteNames {
             BackgroundDefault,
@@ -119,30 +129,54 @@ namespace screen {
         // Player's grids (state of each square) and fleet layouts (where their ships are located)
         std::unique_ptr<shipOrientations> fleetLayoutP1;
         std::unique_ptr<shipOrientations> fleetLayoutP2;
-        std::unique_ptr<Grid> gridP1;
-        std::unique_ptr<Grid> gridP2;
+        engine::Game game;
 
-        // All the targets for this screen
+        // All the targets for this screen and the layer that draws them (slot = square index)
         vector<Target> targetVector;
+        SpriteBatch targetLayer;
+
+        // Where the targets are on the screen, used to find the target under the mouse
+        static const entity::CellLattice targetLattice;
+
+        // Index of the target under the mouse (-1 if the mouse is not over a target)
+        int hoveredTarget = -1;
+
+        // Sets the state of a target and updates its layer
+        void setTargetState(int index, bool active);
+
+        // Markers for each player (index = engine::Game::Player) that show the status of the other player's board
+        // (primary) and of their own board (secondary)
+        MarkerBoard primaryMarkers[2];
+        MarkerBoard secondaryMarkers[2];
+
+        // Sunk ship overlays of each player's grid (slot = ship)
+        SpriteBatch sunkShipsLayers[2];
 
-        // Markers for each player that show the status of the other player's board (hits, current target)
-        vector<sf::Sprite> primaryMarkersP1Vector;
-        vector<sf::Sprite> primaryMarkersP2Vector;
-        vector<sf::Sprite> secondaryMarkersP1Vector;
-        vector<sf::Sprite> secondaryMarkersP2Vector;
+        // Everything that only changes on game events (background, ships, sunk ships and markers)
+        entity::LayerCache staticLayer;
 
-        // Possible coordinates that the environment can attack
-        set<Coordinate> coordinateSet;
+        // Decides what the computer attacks in single player mode (indexed by difficulty, nullptr until first used)
+        std::array<std::unique_ptr<engine::Strategy>, engine::difficultyCount> computers;
 
-        // Selects (and removes) a random coordinate from the coordinates that have not been attacked yet
-        Coordinate randomAttack();
+        // First shots of the hard computer players (empty if the book couldn't be loaded)
+        std::shared_ptr<const engine::OpeningBook> openingBook;
+
+        // The computer's move being decided on a worker thread
+        engine::AsyncMove computerMove;
 
         // Checks if all the ships on a grid have been sunk
-        inline static bool lost(Grid &grid);
+        inline static bool lost(const Grid &grid);
 
         // Updates all the markers on the grid for a given attack on a given coordinate
         void updateGridMarkers(SquareType attack, Coordinate coordinate);
 
+        // Adds a marker to a marker board
+        void addMarker(MarkerBoard &markers, int marker, int texture, Coordinate coordinate, sf::Vector2f position);
+
+        // Position of a marker on the primary (large) and secondary (small) grids
+        static sf::Vector2f primaryMarkerPosition(Coordinate coordinate);
+        static sf::Vector2f secondaryMarkerPosition(Coordinate coordinate);
+
         // Resets all markers for both grids (use when the game is over)
         void resetGridMarkers();
 
@@ -155,15 +189,11 @@ namespace screen {
         // Updates the location of each ship sprite with a given fleet layout
         void setFleetLayout(shipOrientations &fleetLayout);
 
-        // Draws any sunken ships of a specific grid to the screen
-        void renderSunkShips(Grid &grid);
-
-        // How many milliseconds the program execution should pause for after an attack
-        static constexpr int sleepTimeMS = 400;
-
-        // Sleeps the process for Gameplay::sleepTimeMS milliseconds works for (windows and Unix-based systems)
-        inline static void sleepMS();
+        // Shows the sunken ships of a player's grid in its sunk ships layer
+        void updateSunkShips(engine::Game::Player player);
 
+        // How many milliseconds the result of a player's attack is shown for before the turn ends
+        static constexpr int turnDelayMS = 400;
     };
 }// namespace screen
 
@@ -35,26 +35,18 @@ class Homepage &Homepage::getInstance() {
 
 void Homepage::update() {
     sf::Vector2f mousePosition = State::getMousePosition();
-    resources.getButton(buttonNames::PlayButton).updateButtonState(mousePosition);
+    if (resources.updateButtons(mousePosition)) invalidate();
 }
 
-void Homepage::poll() {
-    sf::RenderWindow &gui = *State::gui;
-    sf::Event &event = State::event;
-
-    while (gui.pollEvent(event)) {
-        switch (event.type) {
-            case sf::Event::Closed:
-                gui.close();
-                break;
-            case sf::Event::MouseButtonReleased:
-                if (event.mouseButton.button == sf::Mouse::Left && resources.getButton(buttonNames::PlayButton).getButtonState()) {
-                    State::changeScreen(Screens::GameModeSelection);
-                }
-                break;
-            default:
-                break;
-        }
+void Homepage::handleEvent(const sf::Event &event) {
+    switch (event.type) {
+        case sf::Event::MouseButtonReleased:
+            if (event.mouseButton.button == sf::Mouse::Left && resources.getButton(buttonNames::PlayButton).getButtonState()) {
+                State::changeScreen(Screens::GameModeSelection);
+            }
+            break;
+        default:
+            break;
     }
 }
 
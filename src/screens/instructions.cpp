@@ -36,26 +36,18 @@ class Instructions &screen::Instructions::getInstance() {
 
 void Instructions::update() {
     sf::Vector2f mousePosition = State::getMousePosition();
-    resources.getButton(buttonNames::BackButton).updateButtonState(mousePosition);
+    if (resources.updateButtons(mousePosition)) invalidate();
 }
 
-void Instructions::poll() {
-    sf::RenderWindow &gui = *State::gui;
-    sf::Event &event = State::event;
-
-    while (gui.pollEvent(event)) {
-        switch (event.type) {
-            case sf::Event::Closed:
-                gui.close();
-                break;
-            case sf::Event::MouseButtonReleased:
-                if (event.mouseButton.button == sf::Mouse::Left && resources.getButton(buttonNames::BackButton).getButtonState()) {
-                    State::previousScreen();
-                }
-                break;
-            default:
-                break;
-        }
+void Instructions::handleEvent(const sf::Event &event) {
+    switch (event.type) {
+        case sf::Event::MouseButtonReleased:
+            if (event.mouseButton.button == sf::Mouse::Left && resources.getButton(buttonNames::BackButton).getButtonState()) {
+                State::previousScreen();
+            }
+            break;
+        default:
+            break;
     }
 }
 
@@ -35,7 +35,7 @@ namespace screen {
 
         // SFML event loop helpers
         void update() override;
-        void poll() override;
+        void handleEvent(const sf::Event &event) override;
         void render() override;
 
         // Names to refer to resources on this screen
@@ -37,30 +37,22 @@ class Intermediary &screen::Intermediary::getInstance() {
 
 void Intermediary::update() {
     sf::Vector2f mousePosition = State::getMousePosition();
-    resources.getButton(buttonNames::ContinueButton).updateButtonState(mousePosition);
+    if (resources.updateButtons(mousePosition)) invalidate();
 }
 
-void Intermediary::poll() {
-    sf::RenderWindow &gui = *State::gui;
-    sf::Event &event = State::event;
-
-    while (gui.pollEvent(event)) {
-        switch (event.type) {
-            case sf::Event::Closed:
-                gui.close();
-                break;
-            case sf::Event::MouseButtonReleased:
-                if (event.mouseButton.button == sf::Mouse::Left && resources.getButton(buttonNames::ContinueButton).getButtonState()) {
-                    if (State::player == State::Player::P2 && State::getPreviousScreen() == Screens::FleetPlacement) {
-                        State::changeScreen(Screens::FleetPlacement);
-                    } else {
-                        State::changeScreen(Screens::Gameplay);
-                    }
+void Intermediary::handleEvent(const sf::Event &event) {
+    switch (event.type) {
+        case sf::Event::MouseButtonReleased:
+            if (event.mouseButton.button == sf::Mouse::Left && resources.getButton(buttonNames::ContinueButton).getButtonState()) {
+                if (State::player == State::Player::P2 && State::getPreviousScreen() == Screens::FleetPlacement) {
+                    State::changeScreen(Screens::FleetPlacement);
+                } else {
+                    State::changeScreen(Screens::Gameplay);
                 }
-                break;
-            default:
-                break;
-        }
+            }
+            break;
+        default:
+            break;
     }
 }
 
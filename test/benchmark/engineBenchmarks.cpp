@@ -0,0 +1,205 @@
+/**
+ * Microbenchmarks for the game engine's hot paths (using Google Benchmark)
+ *
+ * Run battleship-bench for a table, or build the bench-json target for machine-readable results
+ */
+
+#include "engine/densityStrategy.hpp"
+#include "engine/game.hpp"
+#include "engine/huntTargetStrategy.hpp"
+#include "engine/monteCarloStrategy.hpp"
+#include "engine/randomStrategy.hpp"
+#include "helpers/gameHelpers.hpp"
+#include <benchmark/benchmark.h>
+
+using engine::Fleet;
+using engine::Game;
+using entity::Bitboard;
+
+namespace {
+    // The same fleet for every run, so results can be compared between builds
+    const Fleet &benchmarkFleet() {
+        static const Fleet fleet = [] {
+            seedRandom(320);
+            return engine::randomFleet();
+        }();
+        return fleet;
+    }
+
+    // Calls a function on every square in a set
+    template<typename Function>
+    void forEachSquare(Bitboard squares, Function function) {
+        while (squares.any()) {
+            function(Coordinate::fromIndex(squares.popLowest()));
+        }
+    }
+
+    // Squares of the benchmark fleet that are ships or water
+    Bitboard shipSquares() {
+        Grid grid(benchmarkFleet());
+        for (int square = 0; square < Grid::size * Grid::size; ++square) {
+            grid.attack(Coordinate::fromIndex(square));
+        }
+        return grid.getHitSquares();
+    }
+    Bitboard waterSquares() {
+        return Grid::allSquares.andNot(shipSquares());
+    }
+
+    // Returns a grid from the middle of a game: every third square has been attacked
+    Grid midgameGrid() {
+        Grid grid(benchmarkFleet());
+        for (int square = 0; square < Grid::size * Grid::size; square += 3) {
+            grid.attack(Coordinate::fromIndex(square));
+        }
+        return grid;
+    }
+}// namespace
+
+
+void BM_GridConstruction(benchmark::State &state) {
+    for (auto _ : state) {
+        Grid grid(benchmarkFleet());
+        benchmark::DoNotOptimize(grid);
+    }
+}
+BENCHMARK(BM_GridConstruction);
+
+void BM_GridConstructionFromLayout(benchmark::State &state) {
+    const engine::FleetLayout layout = engine::toFleetLayout(benchmarkFleet());
+    for (auto _ : state) {
+        Grid grid(layout);
+        benchmark::DoNotOptimize(grid);
+    }
+}
+BENCHMARK(BM_GridConstructionFromLayout);
+
+// Copying a fresh grid is part of the hit and miss benchmarks below; this measures it on its own
+void BM_GridCopy(benchmark::State &state) {
+    const Grid fresh(benchmarkFleet());
+    for (auto _ : state) {
+        Grid grid = fresh;
+        benchmark::DoNotOptimize(grid);
+    }
+}
+BENCHMARK(BM_GridCopy);
+
+void BM_GridAttackHit(benchmark::State &state) {
+    const Grid fresh(benchmarkFleet());
+    const Bitboard targets = shipSquares();
+    for (auto _ : state) {
+        Grid grid = fresh;
+        forEachSquare(targets, [&](const Coordinate coordinate) { benchmark::DoNotOptimize(grid.attack(coordinate)); });
+    }
+    state.SetItemsProcessed(state.iterations() * targets.count());
+}
+BENCHMARK(BM_GridAttackHit);
+
+void BM_GridAttackMiss(benchmark::State &state) {
+    const Grid fresh(benchmarkFleet());
+    const Bitboard targets = waterSquares();
+    for (auto _ : state) {
+        Grid grid = fresh;
+        forEachSquare(targets, [&](const Coordinate coordinate) { benchmark::DoNotOptimize(grid.attack(coordinate)); });
+    }
+    state.SetItemsProcessed(state.iterations() * targets.count());
+}
+BENCHMARK(BM_GridAttackMiss);
+
+void BM_GridAttackRepeat(benchmark::State &state) {
+    Grid grid(benchmarkFleet());
+    for (int square = 0; square < Grid::size * Grid::size; ++square) {
+        grid.attack(Coordinate::fromIndex(square));
+    }
+    int square = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(grid.attack(Coordinate::fromIndex(square)));
+        square = square == Grid::size * Grid::size - 1 ? 0 : square + 1;
+    }
+}
+BENCHMARK(BM_GridAttackRepeat);
+
+// Gameplay::lost
+void BM_Lost(benchmark::State &state) {
+    Game game;
+    game.setFleet(Game::P1, benchmarkFleet());
+    game.setFleet(Game::P2, benchmarkFleet());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(game.lost(Game::P1));
+    }
+}
+BENCHMARK(BM_Lost);
+
+// FleetPlacement::randomize
+void BM_RandomFleetLayout(benchmark::State &state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(engine::randomFleetLayout());
+    }
+}
+BENCHMARK(BM_RandomFleetLayout);
+
+void BM_RandomFleet(benchmark::State &state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(engine::randomFleet());
+    }
+}
+BENCHMARK(BM_RandomFleet);
+
+void BM_UniformRandomFleet(benchmark::State &state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(engine::uniformRandomFleet());
+    }
+}
+BENCHMARK(BM_UniformRandomFleet);
+
+// Gameplay::randomAttack (a full game's worth of picks, then a reset)
+void BM_RandomAttack(benchmark::State &state) {
+    const Grid grid(benchmarkFleet());
+    engine::RandomStrategy strategy;
+    for (auto _ : state) {
+        for (int shot = 0; shot < Grid::size * Grid::size; ++shot) {
+            benchmark::DoNotOptimize(strategy.nextTarget(grid));
+        }
+        strategy.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * Grid::size * Grid::size);
+}
+BENCHMARK(BM_RandomAttack);
+
+void BM_HuntTargetDecision(benchmark::State &state) {
+    const Grid grid = midgameGrid();
+    engine::HuntTargetStrategy strategy;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(strategy.nextTarget(grid));
+    }
+}
+BENCHMARK(BM_HuntTargetDecision);
+
+void BM_DensityDecision(benchmark::State &state) {
+    const Grid grid = midgameGrid();
+    engine::DensityStrategy strategy;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(strategy.nextTarget(grid));
+    }
+}
+BENCHMARK(BM_DensityDecision);
+
+void BM_DensityDecisionEmptyBoard(benchmark::State &state) {
+    const Grid grid(benchmarkFleet());
+    engine::DensityStrategy strategy;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(strategy.nextTarget(grid));
+    }
+}
+BENCHMARK(BM_DensityDecisionEmptyBoard);
+
+// Time per sampled fleet (one thread, no deadline)
+void BM_MonteCarloSample(benchmark::State &state) {
+    const Grid grid = midgameGrid();
+    const auto never = std::chrono::steady_clock::time_point::max();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(engine::MonteCarloStrategy::sample(grid, 1000, never));
+    }
+    state.SetItemsProcessed(state.iterations() * 1000);
+}
+BENCHMARK(BM_MonteCarloSample);
@@ -0,0 +1,86 @@
+/**
+ * Unit tests for the Bitboard square set
+ */
+
+#include "../../src/entity/bitboard.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using entity::Bitboard;
+
+TEST(BitboardTest, StartsEmpty) {
+    const Bitboard board;
+    EXPECT_TRUE(board.none());
+    EXPECT_FALSE(board.any());
+    EXPECT_EQ(board.count(), 0);
+}
+
+TEST(BitboardTest, SetsAndClearsSquaresInBothWords) {
+    Bitboard board;
+    for (const int index : {0, 63, 64, 99, 127}) {
+        board.set(index);
+        EXPECT_TRUE(board.test(index)) << "square " << index;
+    }
+    EXPECT_EQ(board.count(), 5);
+    EXPECT_FALSE(board.test(1));
+    EXPECT_FALSE(board.test(65));
+
+    board.reset(63);
+    board.reset(64);
+    EXPECT_FALSE(board.test(63));
+    EXPECT_FALSE(board.test(64));
+    EXPECT_EQ(board.count(), 3);
+}
+
+TEST(BitboardTest, SquareHasOnlyThatSquare) {
+    for (int index = 0; index < 128; ++index) {
+        const Bitboard board = Bitboard::square(index);
+        EXPECT_EQ(board.count(), 1);
+        EXPECT_EQ(board.lowest(), index);
+    }
+}
+
+TEST(BitboardTest, FirstSquaresSetsAPrefix) {
+    EXPECT_TRUE(Bitboard::firstSquares(0).none());
+    for (const int count : {1, 36, 63, 64, 65, 100, 127, 128}) {
+        const Bitboard board = Bitboard::firstSquares(count);
+        EXPECT_EQ(board.count(), count) << "count " << count;
+        EXPECT_TRUE(board.test(count - 1));
+        if (count < 128) {
+            EXPECT_FALSE(board.test(count));
+        }
+    }
+}
+
+TEST(BitboardTest, SetOperations) {
+    const Bitboard a = Bitboard::square(3) | Bitboard::square(70);
+    const Bitboard b = Bitboard::square(70) | Bitboard::square(100);
+
+    EXPECT_EQ(a & b, Bitboard::square(70));
+    EXPECT_EQ((a | b).count(), 3);
+    EXPECT_EQ(a ^ b, Bitboard::square(3) | Bitboard::square(100));
+    EXPECT_EQ(a.andNot(b), Bitboard::square(3));
+    EXPECT_NE(a, b);
+
+    Bitboard c = a;
+    c &= b;
+    EXPECT_EQ(c, Bitboard::square(70));
+    c |= Bitboard::square(5);
+    c ^= Bitboard::square(70);
+    EXPECT_EQ(c, Bitboard::square(5));
+}
+
+TEST(BitboardTest, PopLowestVisitsSquaresInOrder) {
+    Bitboard board = Bitboard::square(99) | Bitboard::square(2) | Bitboard::square(64) | Bitboard::square(63);
+    std::vector<int> visited;
+    while (board.any()) {
+        visited.push_back(board.popLowest());
+    }
+    EXPECT_EQ(visited, (std::vector<int>{2, 63, 64, 99}));
+}
+
+TEST(BitboardTest, UsableAtCompileTime) {
+    constexpr Bitboard board = (Bitboard::square(42) | Bitboard::square(99)).andNot(Bitboard::square(99));
+    static_assert(board.count() == 1 && board.test(42));
+    EXPECT_TRUE(board.test(42));
+}
@@ -0,0 +1,64 @@
+/**
+ * Unit tests for Coordinate packing, validation and ordering
+ */
+
+#include "../../src/entity/coordinate.hpp"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <unordered_set>
+
+using entity::Coordinate;
+
+TEST(CoordinateTest, PacksIntoOneByte) {
+    static_assert(sizeof(Coordinate) == 1);
+    for (int y = 0; y < 10; ++y) {
+        for (int x = 0; x < 10; ++x) {
+            const Coordinate coord(x, y);
+            EXPECT_EQ(coord.getX(), x);
+            EXPECT_EQ(coord.getY(), y);
+            EXPECT_EQ(coord.getIndex(), y * 10 + x);
+            EXPECT_EQ(Coordinate::fromIndex(coord.getIndex()), coord);
+            EXPECT_EQ(Coordinate::unchecked(x, y), coord);
+        }
+    }
+}
+
+TEST(CoordinateTest, DefaultsToTheTopLeft) {
+    EXPECT_EQ(Coordinate(), Coordinate(0, 0));
+}
+
+TEST(CoordinateTest, CreateRejectsOutOfRangeValues) {
+    ASSERT_TRUE(Coordinate::create(9, 0).has_value());
+    EXPECT_EQ(*Coordinate::create(9, 0), Coordinate(9, 0));
+    EXPECT_FALSE(Coordinate::create(-1, 0).has_value());
+    EXPECT_FALSE(Coordinate::create(0, 10).has_value());
+    EXPECT_FALSE(Coordinate::create(10, 10).has_value());
+}
+
+TEST(CoordinateTest, ConstructorThrowsOutOfRange) {
+    EXPECT_THROW(Coordinate(10, 0), entity::CoordinateException);
+    EXPECT_THROW(Coordinate(0, -1), entity::CoordinateException);
+}
+
+TEST(CoordinateTest, OrdersRowByRow) {
+    EXPECT_LT(Coordinate(9, 0), Coordinate(0, 1));
+    EXPECT_LT(Coordinate(2, 3), Coordinate(3, 3));
+    EXPECT_FALSE(Coordinate(3, 3) < Coordinate(3, 3));
+    EXPECT_NE(Coordinate(1, 2), Coordinate(2, 1));
+}
+
+TEST(CoordinateTest, HashesBySquare) {
+    std::unordered_set<Coordinate> coords;
+    for (int index = 0; index < 100; ++index) {
+        coords.insert(Coordinate::fromIndex(index));
+    }
+    coords.insert(Coordinate(4, 4));
+    EXPECT_EQ(coords.size(), 100u);
+    EXPECT_EQ(std::hash<Coordinate>()(Coordinate(7, 2)), 27u);
+}
+
+TEST(CoordinateTest, PrintsAsAPair) {
+    std::ostringstream output;
+    output << Coordinate(3, 8);
+    EXPECT_EQ(output.str(), "(3, 8)");
+}
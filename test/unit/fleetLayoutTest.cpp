@@ -0,0 +1,106 @@
+/**
+ * Unit tests for the random fleet samplers and fleet legality
+ */
+
+#include "../../src/engine/fleetLayout.hpp"
+#include "../../src/engine/placements.hpp"
+#include "../../src/helpers/gameHelpers.hpp"
+#include <gtest/gtest.h>
+
+using engine::Fleet;
+
+namespace {
+    constexpr int fleetCount = 2000;
+
+    // Squares a ship covers, or nothing if it runs off the grid
+    Bitboard shipSquares(const shipNames ship, const ShipPosition &position) {
+        const int start = position.horizontal ? position.origin.getX() : position.origin.getY();
+        if (start + shipSize(ship) > entity::Grid::size) return {};
+
+        Bitboard squares;
+        for (int i = 0; i < shipSize(ship); ++i) {
+            squares.set(position.origin.getIndex() + i * (position.horizontal ? 1 : entity::Grid::size));
+        }
+        return squares;
+    }
+
+    // Squares of every ship in a fleet
+    Bitboard fleetSquares(const Fleet &fleet) {
+        Bitboard squares;
+        for (int ship = 0; ship < entity::shipCount; ++ship) {
+            squares |= shipSquares(static_cast<shipNames>(ship), fleet[ship]);
+        }
+        return squares;
+    }
+
+    // Share of the fleets' ship squares on the left half of the grid, which is a half for an unbiased sampler
+    double leftShare(Fleet (*sampler)()) {
+        long left = 0, total = 0;
+        for (int i = 0; i < fleetCount; ++i) {
+            Bitboard squares = fleetSquares(sampler());
+            while (squares.any()) {
+                left += squares.popLowest() % entity::Grid::size < entity::Grid::size / 2;
+                total++;
+            }
+        }
+        return (double) left / (double) total;
+    }
+}// namespace
+
+TEST(FleetLayoutTest, SamplersOnlyDealLegalFleets) {
+    seedRandom(1);
+    for (int i = 0; i < fleetCount; ++i) {
+        const Fleet biased = engine::randomFleet();
+        const Fleet uniform = engine::uniformRandomFleet();
+        ASSERT_TRUE(engine::legalFleet(biased));
+        ASSERT_TRUE(engine::legalFleet(uniform));
+        ASSERT_EQ(fleetSquares(uniform).count(), 1 + 2 + 3 + 4 + 5 + 6);
+    }
+}
+
+TEST(FleetLayoutTest, LayoutsMatchTheirFleet) {
+    const Fleet fleet = engine::randomFleet();
+    const engine::FleetLayout layout = engine::toFleetLayout(fleet);
+    ASSERT_EQ(layout.size(), (size_t) entity::shipCount);
+    for (int ship = 0; ship < entity::shipCount; ++ship) {
+        EXPECT_EQ(std::get<0>(layout.at(static_cast<shipNames>(ship))), fleet[ship].origin);
+        EXPECT_EQ(std::get<1>(layout.at(static_cast<shipNames>(ship))), fleet[ship].horizontal);
+    }
+    EXPECT_TRUE(engine::legalFleet(engine::randomFleetLayout()));
+}
+
+TEST(FleetLayoutTest, SamplersFollowTheSeed) {
+    seedRandom(7);
+    const Fleet first = engine::uniformRandomFleet();
+    seedRandom(7);
+    const Fleet second = engine::uniformRandomFleet();
+    EXPECT_EQ(engine::toFleetLayout(first), engine::toFleetLayout(second));
+}
+
+TEST(FleetLayoutTest, SamplersAreSymmetric) {
+    seedRandom(3);
+    EXPECT_NEAR(leftShare(engine::uniformRandomFleet), 0.5, 0.02);
+    EXPECT_NEAR(leftShare(engine::randomFleet), 0.5, 0.02);
+}
+
+TEST(FleetLayoutTest, RejectsShipsThatTouchOrLeaveTheGrid) {
+    Fleet fleet{};
+    for (int ship = 0; ship < entity::shipCount - 1; ++ship) {
+        fleet[ship] = {Coordinate(0, 2 * ship), true};
+    }
+    fleet[5] = {Coordinate(9, 0), false};
+    EXPECT_TRUE(engine::legalFleet(fleet));
+    EXPECT_TRUE(engine::legalFleet(engine::toFleetLayout(fleet)));
+
+    Fleet touching = fleet;
+    touching[0] = {Coordinate(0, 1), true};// Right above the patrol boat
+    EXPECT_FALSE(engine::legalFleet(touching));
+
+    Fleet diagonal = fleet;
+    diagonal[0] = {Coordinate(8, 6), true};// Only touches the battleship's corner
+    EXPECT_TRUE(engine::legalFleet(diagonal));
+
+    Fleet offGrid = fleet;
+    offGrid[5] = {Coordinate(9, 5), false};// Six squares down from row 5 leaves the grid
+    EXPECT_FALSE(engine::legalFleet(offGrid));
+}
@@ -0,0 +1,89 @@
+/**
+ * Unit tests for attacking a Grid: hits, misses and sinking ships
+ */
+
+#include "../../src/entity/grid.hpp"
+#include <gtest/gtest.h>
+
+using entity::Bitboard;
+using entity::Coordinate;
+using entity::Grid;
+using entity::shipNames;
+
+namespace {
+    // Ship n (n + 1 squares long) along row 2n from the left, and the battleship down the right column
+    Grid testGrid() {
+        return Grid({
+                {shipNames::RowBoat, {Coordinate(0, 0), true}},
+                {shipNames::PatrolBoat, {Coordinate(0, 2), true}},
+                {shipNames::Submarine, {Coordinate(0, 4), true}},
+                {shipNames::Destroyer, {Coordinate(0, 6), true}},
+                {shipNames::AircraftCarrier, {Coordinate(0, 8), true}},
+                {shipNames::Battleship, {Coordinate(9, 0), false}},
+        });
+    }
+}// namespace
+
+TEST(GridTest, MissesAreRecordedOnce) {
+    Grid grid = testGrid();
+    EXPECT_EQ(grid.attack(Coordinate(5, 5)), entity::Water);
+    EXPECT_EQ(grid.attack(Coordinate(5, 5)), entity::HitWater);
+    EXPECT_EQ(grid.getMissSquares(), Bitboard::square(55));
+    EXPECT_TRUE(grid.getHitSquares().none());
+}
+
+TEST(GridTest, HitsAreRecordedOnce) {
+    Grid grid = testGrid();
+    EXPECT_EQ(grid.attack(Coordinate(1, 2)), entity::Ship);
+    EXPECT_EQ(grid.attack(Coordinate(1, 2)), entity::HitShip);
+    EXPECT_EQ(grid.getHitSquares(), Bitboard::square(21));
+    EXPECT_FALSE(grid.isSunk(shipNames::PatrolBoat));
+}
+
+TEST(GridTest, ShipSinksWhenEverySquareIsHit) {
+    Grid grid = testGrid();
+    grid.attack(Coordinate(9, 0));
+    grid.attack(Coordinate(9, 1));
+    grid.attack(Coordinate(9, 1));// Hitting a square twice doesn't count twice
+    for (int y = 2; y < 5; ++y) {
+        grid.attack(Coordinate(9, y));
+        EXPECT_FALSE(grid.isSunk(shipNames::Battleship));
+    }
+    grid.attack(Coordinate(9, 5));
+    EXPECT_TRUE(grid.isSunk(shipNames::Battleship));
+    EXPECT_TRUE(grid.getShipStatus()[shipNames::Battleship]);
+    EXPECT_FALSE(grid.getShipStatus()[shipNames::AircraftCarrier]);
+    EXPECT_EQ(grid.getSunkSquares().count(), 6);
+    EXPECT_FALSE(grid.allSunk());
+}
+
+TEST(GridTest, AllSunkAfterEveryShipSquareIsHit) {
+    Grid grid = testGrid();
+    int hits = 0;
+    for (int y = 0; y < Grid::size; ++y) {
+        for (int x = 0; x < Grid::size; ++x) {
+            hits += grid.attack(Coordinate(x, y)) == entity::Ship;
+        }
+    }
+    EXPECT_TRUE(grid.allSunk());
+    EXPECT_EQ(hits, 1 + 2 + 3 + 4 + 5 + 6);
+    EXPECT_EQ(grid.getHitSquares().count(), hits);
+    EXPECT_EQ((grid.getHitSquares() | grid.getMissSquares()).count(), Grid::size * Grid::size);
+    EXPECT_EQ(grid.getSunkSquares(), grid.getHitSquares());
+}
+
+TEST(GridTest, ShipsKeepTheirPositions) {
+    const auto ships = testGrid().getShips();
+    ASSERT_EQ(ships.size(), 6u);
+    EXPECT_TRUE(std::get<0>(ships.at(shipNames::Destroyer)) == Coordinate(0, 6));
+    EXPECT_TRUE(std::get<1>(ships.at(shipNames::Destroyer)));
+    EXPECT_TRUE(std::get<0>(ships.at(shipNames::Battleship)) == Coordinate(9, 0));
+    EXPECT_FALSE(std::get<1>(ships.at(shipNames::Battleship)));
+}
+
+TEST(GridTest, EmptyGridHasNoShips) {
+    Grid grid;
+    EXPECT_EQ(grid.attack(Coordinate(0, 0)), entity::Water);
+    EXPECT_TRUE(grid.getShips().empty());
+    EXPECT_TRUE(grid.allSunk());
+}
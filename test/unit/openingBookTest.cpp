@@ -0,0 +1,80 @@
+/**
+ * Unit tests for the opening book: lookups and the file format round trip
+ */
+
+#include "../../src/engine/openingBook.hpp"
+#include <gtest/gtest.h>
+#include <sstream>
+
+using engine::OpeningBook;
+
+namespace {
+    const std::vector<Coordinate> testShots = {Coordinate(4, 4), Coordinate(6, 2), Coordinate(2, 6), Coordinate(0, 9)};
+}// namespace
+
+TEST(OpeningBookTest, RoundTripsThroughAStream) {
+    const OpeningBook book(testShots);
+    std::stringstream stream;
+    ASSERT_TRUE(book.write(stream));
+    EXPECT_EQ(stream.str().size(), 6 + testShots.size());
+    EXPECT_EQ(stream.str().substr(0, 4), "BSOB");
+
+    OpeningBook loaded;
+    ASSERT_TRUE(OpeningBook::read(stream, loaded));
+    EXPECT_EQ(loaded.getShots(), testShots);
+}
+
+TEST(OpeningBookTest, RejectsInvalidFiles) {
+    std::stringstream valid;
+    ASSERT_TRUE(OpeningBook(testShots).write(valid));
+    const std::string bytes = valid.str();
+
+    auto rejects = [](const std::string &data) {
+        OpeningBook book(testShots);
+        std::istringstream input(data);
+        const bool read = OpeningBook::read(input, book);
+        return !read && book.getShots() == testShots;// A failed read leaves the book unchanged
+    };
+    EXPECT_TRUE(rejects(""));
+    EXPECT_TRUE(rejects("XSOB" + bytes.substr(4)));
+    EXPECT_TRUE(rejects(bytes.substr(0, 4) + char(OpeningBook::version + 1) + bytes.substr(5)));
+    EXPECT_TRUE(rejects(bytes.substr(0, bytes.size() - 1)));// Truncated
+    EXPECT_TRUE(rejects(bytes.substr(0, bytes.size() - 1) + char(100)));// Off the grid
+    EXPECT_TRUE(rejects(bytes.substr(0, bytes.size() - 1) + bytes[6]));// Shoots a square twice
+}
+
+TEST(OpeningBookTest, FollowsTheLineWhileEveryShotMisses) {
+    const OpeningBook book(testShots);
+    Grid grid;
+    for (const Coordinate shot : testShots) {
+        ASSERT_EQ(book.next(grid), shot);
+        grid.attack(shot);
+    }
+    EXPECT_FALSE(book.next(grid).has_value());// Out of shots
+}
+
+TEST(OpeningBookTest, LeavesTheBookOffTheLine) {
+    const OpeningBook book(testShots);
+    Grid grid;
+    grid.attack(Coordinate(5, 5));
+    EXPECT_FALSE(book.next(grid).has_value());
+
+    // A hit ends the opening
+    Grid hit(std::array<entity::ShipPosition, entity::shipCount>{{
+            {Coordinate(4, 4), true},
+            {Coordinate(0, 0), true},
+            {Coordinate(0, 2), true},
+            {Coordinate(0, 6), true},
+            {Coordinate(0, 8), true},
+            {Coordinate(9, 0), false},
+    }});
+    hit.attack(Coordinate(4, 4));
+    EXPECT_FALSE(book.next(hit).has_value());
+}
+
+TEST(OpeningBookTest, EmptyBookHasNoShots) {
+    const OpeningBook book;
+    EXPECT_TRUE(book.empty());
+    EXPECT_FALSE(book.next(Grid()).has_value());
+    EXPECT_THROW(OpeningBook({Coordinate(1, 1), Coordinate(1, 1)}), std::invalid_argument);
+}
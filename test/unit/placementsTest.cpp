@@ -0,0 +1,72 @@
+/**
+ * Unit tests for the compile-time ship placement tables
+ */
+
+#include "../../src/engine/placements.hpp"
+#include "../../src/helpers/gameHelpers.hpp"
+#include <gtest/gtest.h>
+
+using engine::Placement;
+
+namespace {
+    // Every ship name, smallest first
+    constexpr shipNames allShips[entity::shipCount] = {shipNames::RowBoat, shipNames::PatrolBoat, shipNames::Submarine,
+                                                       shipNames::Destroyer, shipNames::AircraftCarrier, shipNames::Battleship};
+}// namespace
+
+TEST(PlacementsTest, ListsEveryPositionThatFits) {
+    EXPECT_EQ(engine::shipPlacements(shipNames::RowBoat).size(), 100);
+    for (const shipNames ship : allShips) {
+        if (shipSize(ship) == 1) continue;
+        // Each orientation has (11 - length) positions along the ship and 10 across it
+        EXPECT_EQ(engine::shipPlacements(ship).size(), 2 * (entity::Grid::size + 1 - shipSize(ship)) * entity::Grid::size);
+    }
+}
+
+TEST(PlacementsTest, PlacementsAreStraightAndOnTheGrid) {
+    for (const shipNames ship : allShips) {
+        for (const Placement &placement : engine::shipPlacements(ship)) {
+            ASSERT_EQ(placement.squares.count(), shipSize(ship));
+            ASSERT_TRUE(placement.squares.test(placement.origin.getIndex()));
+
+            const int step = placement.horizontal ? 1 : entity::Grid::size;
+            Bitboard expected;
+            for (int i = 0; i < shipSize(ship); ++i) {
+                expected.set(placement.origin.getIndex() + i * step);
+            }
+            ASSERT_EQ(placement.squares, expected);
+            const int start = placement.horizontal ? placement.origin.getX() : placement.origin.getY();
+            ASSERT_LE(start + shipSize(ship), entity::Grid::size);
+        }
+    }
+}
+
+TEST(PlacementsTest, NeighboursAreTheOrthogonalHalo) {
+    for (const shipNames ship : allShips) {
+        for (const Placement &placement : engine::shipPlacements(ship)) {
+            ASSERT_EQ((placement.neighbours & placement.squares), Bitboard());
+            ASSERT_EQ(placement.neighbours, engine::neighbourSquares(placement.squares));
+        }
+    }
+
+    // A horizontal patrol boat in the top left corner: the square to its right and the two below it
+    const Placement &corner = engine::placementAt(shipNames::PatrolBoat, Coordinate(0, 0), true);
+    EXPECT_EQ(corner.neighbours, Bitboard::square(2) | Bitboard::square(10) | Bitboard::square(11));
+}
+
+TEST(PlacementsTest, PlacementAtFindsTheListedPosition) {
+    const Placement &placement = engine::placementAt(shipNames::Destroyer, Coordinate(3, 6), false);
+    EXPECT_EQ(placement.origin, Coordinate(3, 6));
+    EXPECT_FALSE(placement.horizontal);
+    EXPECT_EQ(placement.squares, Bitboard::square(63) | Bitboard::square(73) | Bitboard::square(83) | Bitboard::square(93));
+
+    // Doesn't fit: one square too low
+    EXPECT_TRUE(engine::placementAt(shipNames::AircraftCarrier, Coordinate(0, 6), false).squares.none());
+}
+
+TEST(PlacementsTest, TablesAreBuiltAtCompileTime) {
+    constexpr engine::PlacementList placements = engine::shipPlacements(shipNames::Battleship);
+    static_assert(placements.size() == 100);
+    static_assert(placements[0].squares.count() == 6);
+    EXPECT_EQ(placements[0].origin, Coordinate(0, 0));
+}
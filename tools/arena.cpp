@@ -0,0 +1,428 @@
+/**
+ * battleship-arena: plays computer players against each other without the GUI and reports how they perform
+ *
+ * Usage: battleship-arena [--games N] [--threads N] [--seed N] [--budget MS] [--timings FILE] [--book FILE] [--same-fleets] [--p1 STRATEGY] [--p2 STRATEGY]
+ * Strategies: random, hunt (hunt/target), density, montecarlo (Monte Carlo fleet sampling, MS per move),
+ *             or a difficulty tier: easy, medium, hard, expert (see engine/difficulty.hpp)
+ *
+ * The time each move took is summarised for both players, and every move's time is written to FILE as CSV with
+ * --timings (moves are only kept when they are written)
+ * With --book, the hard and expert tiers play the shots of the given opening book first
+ * --threads is capped at the number of cores
+ * With --same-fleets, both players attack the same fleet and each plays on until it has sunk it, so the shots the two
+ * players needed can be compared game by game
+ */
+
+#include "engine/densityStrategy.hpp"
+#include "engine/difficulty.hpp"
+#include "engine/game.hpp"
+#include "engine/huntTargetStrategy.hpp"
+#include "engine/monteCarloStrategy.hpp"
+#include "engine/randomStrategy.hpp"
+#include "helpers/gameHelpers.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <optional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using engine::Game;
+using engine::Strategy;
+using std::string;
+using std::vector;
+
+namespace {
+    // Settings from the command line
+    struct Options {
+        long games = 10000;
+        unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+        unsigned seed = std::random_device{}();
+        long budgetMS = engine::MonteCarloStrategy::defaultBudget.count();
+        string timingsFile;
+        bool sameFleets = false;
+        std::shared_ptr<const engine::OpeningBook> book;
+        string strategies[2] = {"density", "random"};
+    };
+
+    // Time one move took to decide
+    struct MoveTime {
+        long game;
+        int shot;
+        long microseconds;
+    };
+
+    // Number of moves that took each time: exact below 1024 us, then in buckets 1/64 of a power of two wide (so
+    // percentiles are within 1.6%), which keeps the summary the same size however many games are played
+    struct TimeHistogram {
+        vector<long> counts;
+        long moves = 0;
+        long longest = 0;
+
+        // Bucket holding a time, and the shortest time in a bucket
+        static size_t bucket(const long microseconds) {
+            if (microseconds < 1024) return (size_t) std::max(0l, microseconds);
+            int exponent = 10;
+            while ((microseconds >> (exponent + 1)) != 0) ++exponent;
+            return 1024 + (size_t) (exponent - 10) * 64 + (size_t) ((microseconds >> (exponent - 6)) - 64);
+        }
+        static long shortest(const size_t bucket) {
+            if (bucket < 1024) return (long) bucket;
+            const int exponent = (int) ((bucket - 1024) / 64) + 10;
+            return (long) (64 + (bucket - 1024) % 64) << (exponent - 6);
+        }
+
+        void add(const long microseconds) {
+            const size_t index = bucket(microseconds);
+            if (index >= counts.size()) counts.resize(index + 1);
+            counts[index]++;
+            moves++;
+            longest = std::max(longest, microseconds);
+        }
+
+        void merge(const TimeHistogram &other) {
+            if (other.counts.size() > counts.size()) counts.resize(other.counts.size());
+            for (size_t index = 0; index < other.counts.size(); ++index) {
+                counts[index] += other.counts[index];
+            }
+            moves += other.moves;
+            longest = std::max(longest, other.longest);
+        }
+
+        // Shortest time at least the given fraction of moves took no longer than
+        [[nodiscard]] long percentile(const double fraction) const {
+            long seen = 0;
+            for (size_t index = 0; index < counts.size(); ++index) {
+                seen += counts[index];
+                if (seen > 0 && (double) seen >= fraction * (double) moves) return shortest(index);
+            }
+            return longest;
+        }
+    };
+
+    // Results of the games played on one thread (merged at the end)
+    struct Results {
+        long wins[2] = {0, 0};
+
+        // Shots each player needed in the games it won (index = number of shots)
+        vector<long> shotsToWin[2] = {vector<long>(Grid::size * Grid::size + 1), vector<long>(Grid::size * Grid::size + 1)};
+
+        // Shots each player needed to sink the opponent's fleet in every game (only with --same-fleets)
+        vector<long> shotsToSink[2] = {vector<long>(Grid::size * Grid::size + 1), vector<long>(Grid::size * Grid::size + 1)};
+
+        // Sum and sum of squares of the P1 - P2 difference in shots to sink, per game (only with --same-fleets)
+        double differenceSum = 0, differenceSquares = 0;
+
+        // Time each player's moves took, and how many took longer than its budget
+        TimeHistogram moveTimes[2];
+        long overBudget[2] = {0, 0};
+
+        // Every move each player made (only kept when they are written to a file)
+        vector<MoveTime> moves[2];
+
+        void merge(const Results &other) {
+            differenceSum += other.differenceSum;
+            differenceSquares += other.differenceSquares;
+            for (int player = 0; player < 2; ++player) {
+                wins[player] += other.wins[player];
+                for (size_t shots = 0; shots < shotsToWin[player].size(); ++shots) {
+                    shotsToWin[player][shots] += other.shotsToWin[player][shots];
+                    shotsToSink[player][shots] += other.shotsToSink[player][shots];
+                }
+                moveTimes[player].merge(other.moveTimes[player]);
+                overBudget[player] += other.overBudget[player];
+                moves[player].insert(moves[player].end(), other.moves[player].begin(), other.moves[player].end());
+            }
+        }
+    };
+
+    // Returns a new computer player by name, or nullptr if there is no such strategy
+    std::unique_ptr<Strategy> makeStrategy(const string &name, const Options &options) {
+        if (name == "random") return std::make_unique<engine::RandomStrategy>();
+        if (name == "hunt") return std::make_unique<engine::HuntTargetStrategy>();
+        if (name == "density") return std::make_unique<engine::DensityStrategy>();
+        if (name == "montecarlo") {
+            // Games are already played on every thread, so each player samples on its own thread
+            return std::make_unique<engine::MonteCarloStrategy>(std::chrono::milliseconds(options.budgetMS), 1);
+        }
+        if (const std::optional<engine::Difficulty> difficulty = engine::difficultyFromName(name)) {
+            return engine::makeStrategy(*difficulty, 1, options.book);
+        }
+        return nullptr;
+    }
+
+    // Returns the time each move of a strategy may take, or nothing if it has no budget
+    std::optional<long> budgetMicroseconds(const string &name, const Options &options) {
+        if (name == "montecarlo") return options.budgetMS * 1000;
+        if (const std::optional<engine::Difficulty> difficulty = engine::difficultyFromName(name)) {
+            return (long) engine::difficultyTiers[*difficulty].budget.count();
+        }
+        return std::nullopt;
+    }
+
+    // Plays games until the shared counter reaches the total, alternating who attacks first
+    void playGames(const Options &options, std::atomic<long> &nextGame, const unsigned thread, Results &results) {
+        seedRandom(options.seed, thread);// Each thread has its own random stream
+        std::unique_ptr<Strategy> players[2] = {makeStrategy(options.strategies[0], options), makeStrategy(options.strategies[1], options)};
+        const std::optional<long> budgets[2] = {budgetMicroseconds(options.strategies[0], options), budgetMicroseconds(options.strategies[1], options)};
+        const bool keepMoves = !options.timingsFile.empty();
+
+        for (long gameNumber = nextGame++; gameNumber < options.games; gameNumber = nextGame++) {
+            Game game;
+            const engine::Fleet fleet = engine::uniformRandomFleet();
+            game.setFleet(Game::P1, fleet);
+            game.setFleet(Game::P2, options.sameFleets ? fleet : engine::uniformRandomFleet());
+            players[0]->reset();
+            players[1]->reset();
+
+            int shots[2] = {0, 0};
+            auto play = [&](const Game::Player attacker) {
+                const Grid &target = game.getGrid(Game::opponent(attacker));
+                const auto moveStart = std::chrono::steady_clock::now();
+                const Coordinate move = players[attacker]->nextTarget(target);
+                const auto elapsed = std::chrono::steady_clock::now() - moveStart;
+
+                game.attack(attacker, move);
+                shots[attacker]++;
+                const long microseconds = (long) std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+                results.moveTimes[attacker].add(microseconds);
+                results.overBudget[attacker] += budgets[attacker] && microseconds > *budgets[attacker];
+                if (keepMoves) results.moves[attacker].push_back({gameNumber, shots[attacker], microseconds});
+            };
+
+            Game::Player attacker = gameNumber % 2 == 0 ? Game::P1 : Game::P2;
+            while (!game.over()) {
+                play(attacker);
+                attacker = Game::opponent(attacker);
+            }
+
+            const Game::Player winner = game.lost(Game::P2) ? Game::P1 : Game::P2;
+            results.wins[winner]++;
+            results.shotsToWin[winner][shots[winner]]++;
+            if (!options.sameFleets) continue;
+
+            // The loser plays on until it has sunk the same fleet, so both players' shots are known for every game
+            const Game::Player loser = Game::opponent(winner);
+            while (!game.lost(winner)) {
+                play(loser);
+            }
+            for (int player = 0; player < 2; ++player) {
+                results.shotsToSink[player][shots[player]]++;
+            }
+            const double difference = shots[Game::P1] - shots[Game::P2];
+            results.differenceSum += difference;
+            results.differenceSquares += difference * difference;
+        }
+    }
+
+    // Prints the win rate of a player with a 95% Wilson score interval
+    void printWinRate(const string &name, const long wins, const long games) {
+        const double z = 1.96;
+        const double rate = (double) wins / (double) games;
+        const double denominator = 1 + z * z / (double) games;
+        const double centre = (rate + z * z / (2.0 * (double) games)) / denominator;
+        const double margin = z * std::sqrt(rate * (1 - rate) / (double) games + z * z / (4.0 * (double) games * (double) games)) / denominator;
+        std::printf("  %-10s %8ld wins  %6.2f%%  (95%% CI %.2f%% - %.2f%%)\n",
+                    name.c_str(), wins, 100 * rate, 100 * (centre - margin), 100 * (centre + margin));
+    }
+
+    // Prints the mean (with a 95% confidence interval) and percentiles of the shots in a histogram
+    void printShots(const string &name, const vector<long> &histogram) {
+        long games = 0;
+        double sum = 0, squares = 0;
+        for (size_t shots = 0; shots < histogram.size(); ++shots) {
+            games += histogram[shots];
+            sum += (double) (histogram[shots] * (long) shots);
+            squares += (double) (histogram[shots] * (long) (shots * shots));
+        }
+        if (games == 0) {
+            std::printf("  %-10s no games\n", name.c_str());
+            return;
+        }
+
+        const double mean = sum / (double) games;
+        const double variance = games > 1 ? (squares - (double) games * mean * mean) / (double) (games - 1) : 0;
+        const double margin = 1.96 * std::sqrt(variance / (double) games);
+
+        // Smallest number of shots that at least the given fraction of games needed
+        auto percentile = [&](const double fraction) {
+            long seen = 0;
+            for (size_t shots = 0; shots < histogram.size(); ++shots) {
+                seen += histogram[shots];
+                if (seen > 0 && (double) seen >= fraction * (double) games) return (int) shots;
+            }
+            return (int) histogram.size() - 1;
+        };
+
+        std::printf("  %-10s mean %.2f +/- %.2f  sd %.2f  min %d  p10 %d  p50 %d  p90 %d  max %d\n",
+                    name.c_str(), mean, margin, std::sqrt(variance), percentile(0), percentile(0.1),
+                    percentile(0.5), percentile(0.9), percentile(1));
+    }
+
+    // Prints the mean difference in shots to sink between the players with a 95% confidence interval
+    void printDifference(const Results &results, const long games) {
+        const double mean = results.differenceSum / (double) games;
+        const double variance = games > 1 ? (results.differenceSquares - (double) games * mean * mean) / (double) (games - 1) : 0;
+        std::printf("  P1 - P2    mean %.2f +/- %.2f shots  sd %.2f\n", mean, 1.96 * std::sqrt(variance / (double) games),
+                    std::sqrt(variance));
+    }
+
+    // Prints percentiles of the time a player's moves took, and how many went over its budget
+    void printMoveTimes(const string &name, const TimeHistogram &moves, const long over, const std::optional<long> budget) {
+        if (moves.moves == 0) return;
+
+        std::printf("  %-10s p50 %ld us  p99 %ld us  max %ld us", name.c_str(), moves.percentile(0.5), moves.percentile(0.99),
+                    moves.longest);
+        if (budget) {
+            std::printf("  budget %ld us, %ld of %ld moves over (%.3f%%)", *budget, over, moves.moves,
+                        100.0 * (double) over / (double) moves.moves);
+        }
+        std::printf("\n");
+    }
+
+    // Writes every move's time as CSV
+    bool writeMoveTimes(const string &path, const Options &options, const Results &results) {
+        std::ofstream file(path);
+        if (!file) return false;
+
+        file << "player,strategy,game,shot,elapsed_us,budget_us\n";
+        for (int player = 0; player < 2; ++player) {
+            const std::optional<long> budget = budgetMicroseconds(options.strategies[player], options);
+            for (const MoveTime &move : results.moves[player]) {
+                file << "P" << player + 1 << ',' << options.strategies[player] << ',' << move.game << ',' << move.shot << ','
+                     << move.microseconds << ',';
+                if (budget) file << *budget;
+                file << '\n';
+            }
+        }
+        return (bool) file;
+    }
+
+    // Returns the whole number in a command line value, or nothing if it isn't one or is below the minimum
+    std::optional<long> parseNumber(const string &value, const long minimum) {
+        char *end = nullptr;
+        errno = 0;
+        const long number = std::strtol(value.c_str(), &end, 10);
+        if (value.empty() || *end != '\0' || errno == ERANGE || number < minimum) return std::nullopt;
+        return number;
+    }
+
+    void printUsage() {
+        std::printf("Usage: battleship-arena [--games N] [--threads N] [--seed N] [--budget MS] [--timings FILE] [--book FILE] [--same-fleets] [--p1 STRATEGY] [--p2 STRATEGY]\n"
+                    "Strategies: random, hunt, density, montecarlo (--budget: milliseconds per move, default %ld)\n"
+                    "            or a difficulty: easy, medium, hard, expert\n"
+                    "--threads: games are played on up to one thread per core (every core by default)\n"
+                    "--timings: write the time every move took to FILE (CSV)\n"
+                    "--book: opening book for the hard and expert tiers (e.g. res/openings.book)\n"
+                    "--same-fleets: both players attack the same fleet until each has sunk it, and the shots they needed are compared\n",
+                    (long) engine::MonteCarloStrategy::defaultBudget.count());
+    }
+}// namespace
+
+int main(int argc, char *argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const string argument = argv[i];
+        if (argument == "--help" || argument == "-h") {
+            printUsage();
+            return 0;
+        } else if (argument == "--same-fleets") {
+            options.sameFleets = true;
+            continue;
+        } else if (i + 1 >= argc) {
+            printUsage();
+            return 1;
+        }
+
+        const string value = argv[++i];
+        if (argument == "--games" || argument == "--threads" || argument == "--seed" || argument == "--budget") {
+            // Counts and the budget must be positive, the seed may be any 32 bit number
+            const std::optional<long> number = argument == "--seed" ? parseNumber(value, 0) : parseNumber(value, 1);
+            if (!number || (argument != "--games" && argument != "--budget" && *number > (long) UINT32_MAX)) {
+                std::fprintf(stderr, "Error: invalid value '%s' for %s\n", value.c_str(), argument.c_str());
+                printUsage();
+                return 1;
+            }
+
+            if (argument == "--games") options.games = *number;
+            // More threads than cores would only take time from the players' budgets
+            if (argument == "--threads") options.threads = std::min((unsigned) *number, std::max(1u, std::thread::hardware_concurrency()));
+            if (argument == "--seed") options.seed = (unsigned) *number;
+            if (argument == "--budget") options.budgetMS = *number;
+        } else if (argument == "--timings") {
+            options.timingsFile = value;
+        } else if (argument == "--book") {
+            auto book = std::make_shared<engine::OpeningBook>();
+            if (!engine::OpeningBook::load(value, *book)) {
+                std::fprintf(stderr, "Error: '%s' is not an opening book\n", value.c_str());
+                return 1;
+            }
+            options.book = book;
+        } else if (argument == "--p1" || argument == "--p2") {
+            options.strategies[argument == "--p1" ? 0 : 1] = value;
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+    for (const string &name : options.strategies) {
+        if (makeStrategy(name, options) == nullptr) {
+            std::fprintf(stderr, "Error: unknown strategy '%s'\n", name.c_str());
+            printUsage();
+            return 1;
+        }
+    }
+
+    // Play the games on every thread
+    const auto start = std::chrono::steady_clock::now();
+    std::atomic<long> nextGame(0);
+    vector<Results> threadResults(options.threads);
+    vector<std::thread> threads;
+    for (unsigned thread = 0; thread < options.threads; ++thread) {
+        threads.emplace_back(playGames, std::cref(options), std::ref(nextGame), thread, std::ref(threadResults[thread]));
+    }
+    Results results;
+    for (unsigned thread = 0; thread < options.threads; ++thread) {
+        threads[thread].join();
+        results.merge(threadResults[thread]);
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Report
+    const string names[2] = {"P1 " + options.strategies[0], "P2 " + options.strategies[1]};
+    std::printf("%ld games on %u threads in %.2f s (%.0f games/s), seed %u\n",
+                options.games, options.threads, seconds, (double) options.games / seconds, options.seed);
+    std::printf("Win rate:\n");
+    for (int player = 0; player < 2; ++player) {
+        printWinRate(names[player], results.wins[player], options.games);
+    }
+    std::printf("Shots to win:\n");
+    for (int player = 0; player < 2; ++player) {
+        printShots(names[player], results.shotsToWin[player]);
+    }
+    if (options.sameFleets) {
+        std::printf("Shots to sink the same fleet (every game):\n");
+        for (int player = 0; player < 2; ++player) {
+            printShots(names[player], results.shotsToSink[player]);
+        }
+        printDifference(results, options.games);
+    }
+    std::printf("Time per move:\n");
+    for (int player = 0; player < 2; ++player) {
+        printMoveTimes(names[player], results.moveTimes[player], results.overBudget[player],
+                       budgetMicroseconds(options.strategies[player], options));
+    }
+
+    if (!options.timingsFile.empty() && !writeMoveTimes(options.timingsFile, options, results)) {
+        std::fprintf(stderr, "Error: could not write '%s'\n", options.timingsFile.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,53 @@
+/**
+ * battleship-atlas: packs the images of every screen (each folder of res/images) into texture atlases
+ *
+ * Usage: battleship-atlas IMAGES_DIRECTORY ATLAS_DIRECTORY
+ * Writes ATLAS_DIRECTORY/<screen>.png and the manifest ATLAS_DIRECTORY/<screen>.txt for every screen, and
+ * ATLAS_DIRECTORY/shared.png with the images used by more than one screen
+ */
+
+#include "helpers/TextureAtlas.hpp"
+#include <cstdio>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        std::fprintf(stderr, "usage: %s IMAGES_DIRECTORY ATLAS_DIRECTORY\n", argv[0]);
+        return 2;
+    }
+    const fs::path imagesDirectory = argv[1];
+    const fs::path atlasDirectory = argv[2];
+
+    std::error_code error;
+    fs::create_directories(atlasDirectory, error);
+    if (error) {
+        std::fprintf(stderr, "error: unable to create %s\n", atlasDirectory.string().c_str());
+        return 1;
+    }
+
+    vector<TextureAtlas::Atlas> atlases;
+    map<string, TextureAtlas::Manifest> manifests;
+    if (!TextureAtlas::buildScreens(imagesDirectory.string(), atlases, manifests)) {
+        std::fprintf(stderr, "error: unable to read the images in %s\n", imagesDirectory.string().c_str());
+        return 1;
+    }
+
+    for (const auto &atlas : atlases) {
+        const fs::path path = atlasDirectory / (atlas.name + ".png");
+        if (!atlas.image.saveToFile(path.string())) {
+            std::fprintf(stderr, "error: unable to write %s\n", path.string().c_str());
+            return 1;
+        }
+        std::printf("%s: %ux%u atlas\n", atlas.name.c_str(), atlas.image.getSize().x, atlas.image.getSize().y);
+    }
+    for (const auto &[screen, manifest] : manifests) {
+        const fs::path path = atlasDirectory / (screen + ".txt");
+        if (!TextureAtlas::writeManifest(path.string(), manifest)) {
+            std::fprintf(stderr, "error: unable to write %s\n", path.string().c_str());
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,133 @@
+/**
+ * battleship-bundle: builds the asset bundle (see src/helpers/AssetBundle.hpp) from the res/ directory
+ *
+ * Usage: battleship-bundle RES_DIRECTORY OUTPUT_FILE
+ * Packs the images of every screen (each folder of res/images) into atlases (see helpers/TextureAtlas.hpp) and stores
+ * them decoded (RGBA) as atlas/<atlas>.png, every screen's manifest as atlas/<screen>.txt, and the opening book
+ * (openings.book) as is
+ */
+
+#include "helpers/AssetBundle.hpp"
+#include "helpers/TextureAtlas.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace {
+    // An entry to write to the bundle
+    struct Entry {
+        string name;
+        uint32_t type;
+        uint32_t width = 0, height = 0;
+        vector<uint8_t> payload;
+    };
+
+    // Payloads start on a multiple of this many bytes
+    constexpr size_t alignment = 16;
+
+    // Appends a little-endian unsigned integer of N bytes
+    template<typename T, size_t N = sizeof(T)>
+    void writeLittleEndian(vector<uint8_t> &bytes, const T value) {
+        for (size_t i = 0; i < N; ++i) {
+            bytes.push_back((uint8_t) (value >> (8 * i)));
+        }
+    }
+
+    // Adds an atlas image to the entries
+    void addAtlas(const TextureAtlas::Atlas &atlas, vector<Entry> &entries) {
+        const uint8_t *pixels = atlas.image.getPixelsPtr();
+        const size_t pixelBytes = (size_t) atlas.image.getSize().x * atlas.image.getSize().y * 4;
+        entries.push_back({"atlas/" + atlas.name + ".png", AssetBundle::ImageEntry, atlas.image.getSize().x, atlas.image.getSize().y,
+                           pixels == nullptr ? vector<uint8_t>() : vector<uint8_t>(pixels, pixels + pixelBytes)});
+        std::printf("%s: %ux%u atlas\n", atlas.name.c_str(), atlas.image.getSize().x, atlas.image.getSize().y);
+    }
+
+    // Adds a screen's manifest to the entries
+    void addManifest(const string &screen, const TextureAtlas::Manifest &regions, vector<Entry> &entries) {
+        std::ostringstream manifest;
+        TextureAtlas::writeManifest(manifest, regions);
+        const string text = manifest.str();
+        entries.push_back({"atlas/" + screen + ".txt", AssetBundle::RawEntry, 0, 0, vector<uint8_t>(text.begin(), text.end())});
+    }
+
+    // Writes the bundle file, returns false on failure
+    bool writeBundle(const fs::path &path, const vector<Entry> &entries) {
+        // Size of the index, to find where the payloads start
+        size_t indexSize = 0;
+        for (const auto &entry : entries) {
+            indexSize += AssetBundle::entryHeaderSize + entry.name.size();
+        }
+
+        vector<uint8_t> header(AssetBundle::magic, AssetBundle::magic + 4), index;
+        writeLittleEndian<uint32_t>(header, AssetBundle::version);
+        writeLittleEndian<uint32_t>(header, (uint32_t) entries.size());
+        writeLittleEndian<uint32_t>(header, (uint32_t) indexSize);
+
+        vector<uint64_t> offsets;
+        uint64_t offset = header.size() + indexSize;
+        for (const auto &entry : entries) {
+            offset = (offset + alignment - 1) / alignment * alignment;
+            offsets.push_back(offset);
+
+            writeLittleEndian<uint32_t>(index, entry.type);
+            writeLittleEndian<uint32_t>(index, entry.width);
+            writeLittleEndian<uint32_t>(index, entry.height);
+            writeLittleEndian<uint64_t>(index, offset);
+            writeLittleEndian<uint64_t>(index, entry.payload.size());
+            writeLittleEndian<uint16_t>(index, (uint16_t) entry.name.size());
+            index.insert(index.end(), entry.name.begin(), entry.name.end());
+
+            offset += entry.payload.size();
+        }
+
+        std::ofstream bundle(path, std::ios::binary);
+        bundle.write(reinterpret_cast<const char *>(header.data()), (std::streamsize) header.size());
+        bundle.write(reinterpret_cast<const char *>(index.data()), (std::streamsize) index.size());
+        uint64_t written = header.size() + index.size();
+        for (size_t i = 0; i < entries.size(); ++i) {
+            for (; written < offsets[i]; ++written) bundle.put(0);// Padding
+            bundle.write(reinterpret_cast<const char *>(entries[i].payload.data()), (std::streamsize) entries[i].payload.size());
+            written += entries[i].payload.size();
+        }
+        return (bool) bundle;
+    }
+}// namespace
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        std::fprintf(stderr, "usage: %s RES_DIRECTORY OUTPUT_FILE\n", argv[0]);
+        return 2;
+    }
+    const fs::path imagesDirectory = fs::path(argv[1]) / "images";
+
+    vector<TextureAtlas::Atlas> atlases;
+    map<string, TextureAtlas::Manifest> manifests;
+    if (!TextureAtlas::buildScreens(imagesDirectory.string(), atlases, manifests)) {
+        std::fprintf(stderr, "error: unable to read the images in %s\n", imagesDirectory.string().c_str());
+        return 1;
+    }
+
+    vector<Entry> entries;
+    for (const auto &atlas : atlases) {
+        addAtlas(atlas, entries);
+    }
+    for (const auto &[screen, manifest] : manifests) {
+        addManifest(screen, manifest, entries);
+    }
+
+    // The opening book is optional: the computer plays without one if it is missing
+    std::ifstream book(fs::path(argv[1]) / "openings.book", std::ios::binary);
+    if (book) {
+        const vector<uint8_t> bytes((std::istreambuf_iterator<char>(book)), std::istreambuf_iterator<char>());
+        entries.push_back({"openings.book", AssetBundle::RawEntry, 0, 0, bytes});
+    }
+
+    if (!writeBundle(argv[2], entries)) {
+        std::fprintf(stderr, "error: unable to write %s\n", argv[2]);
+        return 1;
+    }
+    return 0;
+}
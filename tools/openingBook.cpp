@@ -0,0 +1,177 @@
+/**
+ * battleship-openings: computes the opening book of the hard computer players (see src/engine/openingBook.hpp)
+ *
+ * Usage: battleship-openings OUTPUT_FILE [--shots N] [--samples N] [--threads N] [--seed N]
+ * Each shot is the square with a ship in the most of N sampled fleets, given that the shots before it missed
+ * (fleets follow the no-touch rule and are weighted so every legal fleet counts equally)
+ */
+
+#include "engine/fleetLayout.hpp"
+#include "engine/monteCarloStrategy.hpp"
+#include "engine/openingBook.hpp"
+#include "engine/placements.hpp"
+#include "engine/threadPool.hpp"
+#include "helpers/gameHelpers.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <vector>
+
+using engine::MonteCarloStrategy;
+using std::string;
+using std::vector;
+
+namespace {
+    // Settings from the command line
+    struct Options {
+        string output;
+        int shots = 10;
+        long samples = 200000;
+        unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+        unsigned seed = 1;
+    };
+
+    // Places the ships from the index-th one on (in deployment order) clear of the blocked squares, trying each
+    // position in table order and backing up when a ship has nowhere left to go. Returns false if no fleet fits
+    bool placeShips(engine::Fleet &fleet, const int index, const entity::Bitboard blocked) {
+        if (index == entity::shipCount) return true;
+
+        const entity::shipNames ship = engine::deploymentOrder[index];
+        for (const engine::Placement &placement : engine::shipPlacements(ship)) {
+            if ((placement.squares & blocked).any()) continue;
+            fleet[static_cast<int>(ship)] = {placement.origin, placement.horizontal};
+            if (placeShips(fleet, index + 1, blocked | placement.squares | placement.neighbours)) return true;
+        }
+        return false;
+    }
+
+    // Returns a grid where the given shots have been made and all missed, or nothing if no fleet avoids them all
+    // The samples only depend on the squares that were shot, so any fleet clear of the shots will do
+    std::optional<Grid> gridAfterMisses(const vector<Coordinate> &shots) {
+        entity::Bitboard misses;
+        for (const Coordinate shot : shots) {
+            misses.set(shot.getIndex());
+        }
+
+        engine::Fleet fleet{};
+        if (!placeShips(fleet, 0, misses)) return std::nullopt;
+
+        Grid grid(fleet);
+        for (const Coordinate shot : shots) {
+            grid.attack(shot);
+        }
+        return grid;
+    }
+
+    // Returns the untried square with a ship in the most sampled fleets (the lowest square on a tie)
+    Coordinate bestShot(const Grid &grid, const Options &options, engine::ThreadPool &pool, const int shot) {
+        // At most INT_MAX fleets are sampled in all (checked on the command line), so a thread's share fits an int
+        const int perThread = (int) ((options.samples + (long) pool.size() - 1) / (long) pool.size());
+        const auto never = std::chrono::steady_clock::time_point::max();
+
+        vector<std::future<MonteCarloStrategy::Samples>> results;
+        for (unsigned thread = 0; thread < pool.size(); ++thread) {
+            results.push_back(pool.submit([&grid, &options, perThread, never, shot, thread] {
+                seedRandom(options.seed, shot * 1000 + thread);
+                return MonteCarloStrategy::sample(grid, perThread, never);
+            }));
+        }
+        MonteCarloStrategy::Samples total;
+        for (auto &result : results) {
+            const MonteCarloStrategy::Samples samples = result.get();
+            for (int square = 0; square < Grid::size * Grid::size; ++square) {
+                total.occupancy[square] += samples.occupancy[square];
+            }
+            total.fleets += samples.fleets;
+        }
+
+        const entity::Bitboard tried = grid.getMissSquares();
+        int best = -1;
+        for (int square = 0; square < Grid::size * Grid::size; ++square) {
+            if (!tried.test(square) && (best == -1 || total.occupancy[square] > total.occupancy[best])) best = square;
+        }
+        return Coordinate::fromIndex(best);
+    }
+
+    // Returns the whole number in a command line value, or nothing if it isn't one or is outside [minimum, maximum]
+    std::optional<long> parseNumber(const string &value, const long minimum, const long maximum) {
+        char *end = nullptr;
+        errno = 0;
+        const long number = std::strtol(value.c_str(), &end, 10);
+        if (value.empty() || *end != '\0' || errno == ERANGE || number < minimum || number > maximum) return std::nullopt;
+        return number;
+    }
+
+    void printUsage() {
+        std::printf("Usage: battleship-openings OUTPUT_FILE [--shots N] [--samples N] [--threads N] [--seed N]\n"
+                    "Defaults: 10 shots, 200000 sampled fleets per shot\n");
+    }
+}// namespace
+
+int main(int argc, char *argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const string argument = argv[i];
+        if (argument == "--help" || argument == "-h") {
+            printUsage();
+            return 0;
+        } else if (argument.rfind("--", 0) != 0) {
+            options.output = argument;
+            continue;
+        } else if (i + 1 >= argc) {
+            printUsage();
+            return 1;
+        }
+
+        const string value = argv[++i];
+        if (argument != "--shots" && argument != "--samples" && argument != "--threads" && argument != "--seed") {
+            printUsage();
+            return 1;
+        }
+
+        // A book holds at most 255 shots, the seed may be any 32 bit number and the other counts must be positive
+        // (samples are counted in ints)
+        const std::optional<long> number = argument == "--shots" ? parseNumber(value, 0, 255)
+                                           : argument == "--seed"  ? parseNumber(value, 0, UINT32_MAX)
+                                                                   : parseNumber(value, 1, argument == "--threads" ? UINT32_MAX : INT_MAX);
+        if (!number) {
+            std::fprintf(stderr, "Error: invalid value '%s' for %s\n", value.c_str(), argument.c_str());
+            printUsage();
+            return 1;
+        }
+
+        if (argument == "--shots") options.shots = (int) *number;
+        if (argument == "--samples") options.samples = *number;
+        if (argument == "--threads") options.threads = (unsigned) *number;
+        if (argument == "--seed") options.seed = (unsigned) *number;
+    }
+    if (options.output.empty()) {
+        printUsage();
+        return 1;
+    }
+
+    // Each shot assumes the ones before it missed
+    engine::ThreadPool pool(options.threads);
+    vector<Coordinate> shots;
+    for (int shot = 0; shot < options.shots; ++shot) {
+        const std::optional<Grid> grid = gridAfterMisses(shots);
+        if (!grid) {
+            // Every fleet has a ship on one of the shots, so the game has always left the book by now
+            std::printf("no fleet avoids the first %d shots, the book ends there\n", shot);
+            break;
+        }
+        const Coordinate next = bestShot(*grid, options, pool, shot);
+        shots.push_back(next);
+        std::printf("shot %2d: (%d, %d)\n", shot + 1, next.getX(), next.getY());
+    }
+
+    if (!engine::OpeningBook(shots).save(options.output)) {
+        std::fprintf(stderr, "Error: could not write '%s'\n", options.output.c_str());
+        return 1;
+    }
+    return 0;
+}